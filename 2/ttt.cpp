@@ -1,57 +1,49 @@
 #include <iostream>
-#include <vector>
 #include <limits>
 #include <unordered_map>
+#include <cstdint>
 
 using namespace std;
+
+// Cells are numbered 0-8 row by row; bit n of a player's mask is set when
+// that player owns cell n.
+const uint16_t FULL_BOARD = 0x1FF;
+
+// The 8 winning lines, in the order check_board reports them:
+// row i is checked before column i, then the two diagonals.
+const uint16_t WIN_MASKS[8] = {
+    0x007, 0x049,   // row 0, column 0
+    0x038, 0x092,   // row 1, column 1
+    0x1C0, 0x124,   // row 2, column 2
+    0x111, 0x054    // main diagonal, anti-diagonal
+};
+
+// Bitboard: one 9-bit mask per player
+struct Board {
+    uint16_t ai;     // cells taken by the AI (X)
+    uint16_t human;  // cells taken by the human (O)
+};
+
 // Function to check the board for a win, lose, or draw condition
-void check_board(const vector<vector<int>>& board) {
-    // Check rows and columns for win/lose condition
-    for (int i = 0; i < 3; i++) {
-        if (board[i][0] == board[i][1] && board[i][1] == board[i][2]) {
-            if (board[i][0] != 0) {
-                cout << (board[i][0] == 1 ? "I WIN" : "I LOSE") << endl;
+void check_board(const Board& board) {
+    // Check rows, columns and diagonals for win/lose condition
+    for (int i = 0; i < 8; i++) {
+        uint16_t line = WIN_MASKS[i];
+        bool ai_line = (board.ai & line) == line;
+        if (ai_line || (board.human & line) == line) {
+            if (i < 6 && i % 2 == 0) { // rows
+                cout << (ai_line ? "I WIN" : "I LOSE") << endl;
                 cout << "good game" << endl;
-                exit(0);
-            }
-        }
-        if (board[0][i] == board[1][i] && board[1][i] == board[2][i]) {
-            if (board[0][i] != 0) {
-                cout << (board[0][i] == 1 ? "WIN" : "LOSE") << endl;
+            } else {
+                cout << (ai_line ? "WIN" : "LOSE") << endl;
                 cout << "gg" << endl;
-                exit(0);
             }
-        }
-    }
-
-    // Check diagonals for win/lose condition
-    if (board[0][0] == board[1][1] && board[1][1] == board[2][2]) {
-        if (board[0][0] != 0) {
-            cout << (board[0][0] == 1 ? "WIN" : "LOSE") << endl;
-            cout << "gg" << endl;
-            exit(0);
-        }
-    }
-    if (board[0][2] == board[1][1] && board[1][1] == board[2][0]) {
-        if (board[0][2] != 0) {
-            cout << (board[0][2] == 1 ? "WIN" : "LOSE") << endl;
-            cout << "gg" << endl;
             exit(0);
         }
     }
 
     // Check for draw condition
-    bool isDraw = true;
-    for (const auto& row : board) {
-        for (int cell : row) {
-            if (cell == 0) {
-                isDraw = false;
-                break;
-            }
-        }
-        if (!isDraw) break;
-    }
-    if (isDraw) {
+    if ((board.ai | board.human) == FULL_BOARD) {
         cout << "DRAW" << endl;
         exit(0);
     }
@@ -87,44 +79,40 @@ int main(int argc, char* argv[]) {
         }
     }
 
-    vector<int> matrix(9);
-    vector<vector<int>> board(3, vector<int>(3, 0));
-
+    // order[i] is the cell the AI tries i-th, rank[cell] is its position in that order
+    int order[9];
+    int rank[9];
     for (int i = 0; i < 9; i++) {
-        matrix[i] = select[i] - '0';
+        order[i] = select[i] - '1';
+        rank[order[i]] = i;
     }
 
-    for (size_t i = 0; i < matrix.size(); i++) {
-        cout << matrix.at(i) << " ";
+    for (int i = 0; i < 9; i++) {
+        cout << order[i] + 1 << " ";
     }
     cout << endl;
 
+    Board board = {0, 0};
+    // Bit i is set while cell order[i] is still free, so the AI's choice is
+    // the lowest set bit
+    uint16_t free_rank = FULL_BOARD;
+
     bool turn = true; // true for AI, false for human
 
     for (int j = 0; j < 9; j++) {
         if (turn) {
-//            bool moveMade = false;
-            for (int i = 0; i < 9; i++) {
-                int num = matrix.at(i) - 1; // Adjusting 1-9 to 0-8 for indexing
-//                if (num < 0 || num > 8) continue; // Ensure num is within valid range
-
+            int pick = __builtin_ctz(free_rank);
+            for (int i = 0; i <= pick; i++) {
+                int num = order[i];
                 int row = num / 3;
                 int col = num % 3;
 
                 // Debugging: Print AI move information
                 cout << "AI move: i = " << i << ", num = " << num << ", row = " << row << ", col = " << col << endl;
-
-                if (board[row][col] == 0) {
-                    board[row][col] = 1;
-                    turn = false;
-//                    moveMade = true;
-                    break;
-                }
             }
-//            if (!moveMade) {
-//                cout << "No valid moves for AI. Ending game." << endl;
-//                exit(1);
-//            }
+            board.ai |= 1 << order[pick];
+            free_rank &= ~(1 << pick);
+            turn = false;
         } else {
             int num = 0;
             while (true) {
@@ -140,10 +128,12 @@ int main(int argc, char* argv[]) {
                     // Debugging: Print human move information
                     cout << "Human move: num = " << num << ", row = " << row+1 << ", col = " << col+1 << endl;
 
-                    if (board[row][col] != 0) {
+                    uint16_t cell = 1 << (num - 1);
+                    if ((board.ai | board.human) & cell) {
                         cout << "Invalid move. The cell is already occupied. Try again." << endl;
                     } else {
-                        board[row][col] = -1;
+                        board.human |= cell;
+                        free_rank &= ~(1 << rank[num - 1]);
                         turn = true;
                         break;
                     }
@@ -153,28 +143,21 @@ int main(int argc, char* argv[]) {
 
         // Debugging: Print the board state after each move
         cout << "Board state after move:" << endl;
-//        for (const auto& row : board) {
-//            for (int cell : row) {
-//                cout << cell << " ";
-//            }
-//            cout << endl;
-//        }
-//        cout << endl;
             int i=1;
             for(int row = 0; row < 3; row++){
                 std::cout << "--------------"<<std::endl;
                 std::cout << "| ";
                 for(int column = 0; column < 3; column++){
-                    if (board[row][column] == 1){
+                    uint16_t cell = 1 << (row * 3 + column);
+                    if (board.ai & cell){
                         std::cout << "X | ";
                     }
-                    else if (board[row][column] == -1){
+                    else if (board.human & cell){
                         std::cout << "O | ";
                     }
-                    else if (board[row][column] == 0){
+                    else {
                         std::cout <<i<< "  | ";
                     }
-//                    std::cout << board[row][column] << " | ";
                     i++;
                 }
                 std::cout << std::endl;
@@ -186,4 +169,4 @@ int main(int argc, char* argv[]) {
 
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,242 @@
+#include "analyze.h"
+#include "board.h"
+#include <cerrno>
+#include <cstring>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+using namespace std;
+
+// Largest read, and so the largest batch, in bytes
+const size_t READ_SIZE = 1 << 20;
+// Batches each worker may have in flight, read but not yet written
+const unsigned SLOTS_PER_THREAD = 2;
+
+enum SlotState { SLOT_EMPTY, SLOT_FILLED, SLOT_DONE };
+
+struct Batch {
+    SlotState state;
+    string input;
+    string output;
+    uint64_t positions;
+};
+
+// Batch n lives in slot n % slots.size(). The reader fills empty slots in
+// order, the workers answer filled ones in any order, and the writer
+// empties answered ones in order, so output order is input order.
+struct Pipeline {
+    mutex lock;
+    condition_variable changed;
+    vector<Batch> slots;
+    deque<uint64_t> todo;       // filled batches no worker has taken
+    uint64_t batches;           // batches filled so far
+    bool finished;              // input is exhausted
+};
+
+// Function to answer one position
+static AnswerRecord analyze(uint16_t x, uint16_t o) {
+    AnswerRecord answer = {ANALYZE_INVALID, 0, 0, 0};
+    if ((x | o) > FULL_BOARD || (x & o)) return answer;
+    uint16_t entry = lookup(x, o);
+    Status status = entry_status(entry);
+    // Unreachable positions were never solved and read as ongoing with no moves
+    if (status == STATUS_ONGOING && entry_moves(entry) == 0) return answer;
+    answer.status = status;
+    if (status == STATUS_ONGOING) {
+        answer.value = entry_value(entry);
+        answer.cell = __builtin_ctz(entry_moves(entry)) + 1;
+    }
+    return answer;
+}
+
+// Function to parse one text line into a position; false if it is not one
+static bool parse_position(const char* begin, const char* end, uint16_t& x, uint16_t& o) {
+    int cells = 0;
+    x = o = 0;
+    for (const char* c = begin; c < end; c++) {
+        switch (*c) {
+            case 'X': case 'x':
+                if (cells == 9) return false;
+                x |= 1 << cells++;
+                break;
+            case 'O': case 'o':
+                if (cells == 9) return false;
+                o |= 1 << cells++;
+                break;
+            case '.': case '-':
+                if (cells == 9) return false;
+                cells++;
+                break;
+            case ' ': case '/': case '\t': case '\r':
+                break;
+            default:
+                return false;
+        }
+    }
+    return cells == 9;
+}
+
+// Function to answer every position of a batch
+static void answer_batch(Batch& batch, AnalyzeFormat format) {
+    const char* data = batch.input.data();
+    size_t length = batch.input.length();
+    batch.output.clear();
+    batch.positions = 0;
+
+    if (format == ANALYZE_BINARY) {
+        batch.output.resize(length);
+        for (size_t i = 0; i + sizeof(PositionRecord) <= length; i += sizeof(PositionRecord)) {
+            PositionRecord position;
+            memcpy(&position, data + i, sizeof(position));
+            AnswerRecord answer = analyze(position.x, position.o);
+            memcpy(&batch.output[i], &answer, sizeof(answer));
+            batch.positions++;
+        }
+        return;
+    }
+
+    static const char states[] = "-XOD";
+    static const char values[] = "LDW";
+    batch.output.reserve(length);
+    const char* end = data + length;
+    for (const char* line = data; line < end;) {
+        const char* newline = (const char*)memchr(line, '\n', end - line);
+        uint16_t x, o;
+        AnswerRecord answer = {ANALYZE_INVALID, 0, 0, 0};
+        if (parse_position(line, newline, x, o)) {
+            answer = analyze(x, o);
+        }
+        if (answer.status == ANALYZE_INVALID) {
+            batch.output += 'E';
+        } else if (answer.status == STATUS_ONGOING) {
+            char text[] = {'-', ' ', values[answer.value], ' ', char('0' + answer.cell)};
+            batch.output.append(text, sizeof(text));
+        } else {
+            batch.output += states[answer.status];
+        }
+        batch.output += '\n';
+        batch.positions++;
+        line = newline + 1;
+    }
+}
+
+// Function run by each worker
+static void analyze_worker(Pipeline& pipeline, AnalyzeFormat format) {
+    unique_lock<mutex> guard(pipeline.lock);
+    while (true) {
+        pipeline.changed.wait(guard, [&] { return !pipeline.todo.empty() || pipeline.finished; });
+        if (pipeline.todo.empty()) return;
+        uint64_t n = pipeline.todo.front();
+        pipeline.todo.pop_front();
+        Batch& batch = pipeline.slots[n % pipeline.slots.size()];
+        guard.unlock();
+        answer_batch(batch, format);
+        guard.lock();
+        batch.state = SLOT_DONE;
+        pipeline.changed.notify_all();
+    }
+}
+
+// Function to write out answered batches in order
+static void write_batches(Pipeline& pipeline, int out_fd, uint64_t& positions) {
+    unique_lock<mutex> guard(pipeline.lock);
+    for (uint64_t n = 0;; n++) {
+        Batch& batch = pipeline.slots[n % pipeline.slots.size()];
+        pipeline.changed.wait(guard, [&] {
+            return (n < pipeline.batches && batch.state == SLOT_DONE) || (pipeline.finished && n == pipeline.batches);
+        });
+        if (n == pipeline.batches) return;
+        guard.unlock();
+        const char* data = batch.output.data();
+        size_t left = batch.output.length();
+        while (left > 0) {
+            ssize_t written = write(out_fd, data, left);
+            if (written < 0 && errno == EINTR) continue;
+            if (written <= 0) break;
+            data += written;
+            left -= written;
+        }
+        positions += batch.positions;
+        guard.lock();
+        batch.state = SLOT_EMPTY;
+        pipeline.changed.notify_all();
+    }
+}
+
+uint64_t run_analyze(int in_fd, int out_fd, AnalyzeFormat format, unsigned threads) {
+    if (threads == 0) {
+        threads = 1;
+    }
+    Pipeline pipeline;
+    pipeline.slots.resize(threads * SLOTS_PER_THREAD + 1);
+    for (Batch& batch : pipeline.slots) {
+        batch.state = SLOT_EMPTY;
+    }
+    pipeline.batches = 0;
+    pipeline.finished = false;
+
+    uint64_t positions = 0;
+    vector<thread> workers;
+    for (unsigned t = 0; t < threads; t++) {
+        workers.push_back(thread(analyze_worker, ref(pipeline), format));
+    }
+    thread writer(write_batches, ref(pipeline), out_fd, ref(positions));
+
+    // Each read goes straight into the next batch; whatever follows its
+    // last complete line or record carries over to the batch after
+    vector<char> buffer(READ_SIZE);
+    string carry;
+    bool eof = false;
+    while (!eof) {
+        Batch* batch;
+        {
+            unique_lock<mutex> guard(pipeline.lock);
+            batch = &pipeline.slots[pipeline.batches % pipeline.slots.size()];
+            pipeline.changed.wait(guard, [&] { return batch->state == SLOT_EMPTY; });
+        }
+        string& input = batch->input;
+        input.swap(carry);
+        ssize_t n;
+        do {
+            n = read(in_fd, buffer.data(), buffer.size());
+        } while (n < 0 && errno == EINTR);
+        eof = (n <= 0);
+        if (n > 0) input.append(buffer.data(), n);
+
+        size_t complete;
+        if (format == ANALYZE_BINARY) {
+            // A partial record at the end of the input is dropped
+            complete = input.length() - input.length() % sizeof(PositionRecord);
+        } else {
+            if (eof && !input.empty() && input.back() != '\n') input += '\n';
+            size_t newline = input.rfind('\n');
+            complete = (newline == string::npos) ? 0 : newline + 1;
+        }
+        carry.assign(input, complete, string::npos);
+        input.resize(complete);
+        if (complete == 0) {
+            continue;       // nothing whole yet: it all carries over
+        }
+
+        lock_guard<mutex> guard(pipeline.lock);
+        batch->state = SLOT_FILLED;
+        pipeline.todo.push_back(pipeline.batches++);
+        pipeline.changed.notify_all();
+    }
+
+    {
+        lock_guard<mutex> guard(pipeline.lock);
+        pipeline.finished = true;
+        pipeline.changed.notify_all();
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    writer.join();
+    return positions;
+}
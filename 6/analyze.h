@@ -0,0 +1,38 @@
+#ifndef ANALYZE_H
+#define ANALYZE_H
+
+#include <cstdint>
+
+// Bulk position analysis (ttt --analyze): classic positions in, solved-table
+// answers out, one answer per position in input order.
+//
+// Text positions are lines of 9 cells row by row, each X, O, or . (or -)
+// for empty; spaces and '/' between cells are ignored, so "X.O/.X./..."
+// reads as well as "X.O.X....". The answer is a line: "- <W|D|L> <cell>"
+// for a game in progress, with the value for the side to move and its best
+// move numbered from 1; "X", "O" or "D" for a finished game; "E" for a line
+// that is not a reachable position.
+enum AnalyzeFormat { ANALYZE_TEXT, ANALYZE_BINARY };
+
+// Fixed-size binary records (--analyze=binary), in host byte order
+struct PositionRecord {
+    uint16_t x;         // X's cells, bit n for cell n
+    uint16_t o;
+};
+
+const uint8_t ANALYZE_INVALID = 4;
+
+struct AnswerRecord {
+    uint8_t status;     // Status (board.h), or ANALYZE_INVALID
+    uint8_t value;      // Value for the side to move, if ongoing
+    uint8_t cell;       // best move numbered from 1, 0 if none
+    uint8_t reserved;
+};
+
+// Function to answer every position read from in_fd on out_fd. Input is
+// read and cut into batches by the calling thread, worker threads answer
+// the batches, and a writer thread puts them out in order. Returns the
+// number of positions answered.
+uint64_t run_analyze(int in_fd, int out_fd, AnalyzeFormat format, unsigned threads);
+
+#endif
@@ -0,0 +1,120 @@
+#include "batch.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define BATCH_X86 1
+#endif
+
+using namespace std;
+
+// Function to compute the status of one position
+static inline uint8_t status_of(uint16_t x, uint16_t o) {
+    if (has_line(x)) return STATUS_X_WINS;
+    if (has_line(o)) return STATUS_O_WINS;
+    if ((x | o) == FULL_BOARD) return STATUS_DRAW;
+    return STATUS_ONGOING;
+}
+
+static void evaluate_scalar(const uint16_t* x, const uint16_t* o, uint8_t* status, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        status[i] = status_of(x[i], o[i]);
+    }
+}
+
+#ifdef BATCH_X86
+
+// 8 positions per step: every line mask is tested against 8 16-bit lanes
+// at once, and the three outcomes are blended into the status bytes.
+static void evaluate_sse2(const uint16_t* x, const uint16_t* o, uint8_t* status, size_t count) {
+    const __m128i full = _mm_set1_epi16(FULL_BOARD);
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i vx = _mm_loadu_si128((const __m128i*)(x + i));
+        __m128i vo = _mm_loadu_si128((const __m128i*)(o + i));
+        __m128i x_line = zero, o_line = zero;
+        for (int l = 0; l < 8; l++) {
+            __m128i mask = _mm_set1_epi16(WIN_MASKS[l]);
+            x_line = _mm_or_si128(x_line, _mm_cmpeq_epi16(_mm_and_si128(vx, mask), mask));
+            o_line = _mm_or_si128(o_line, _mm_cmpeq_epi16(_mm_and_si128(vo, mask), mask));
+        }
+        __m128i draw = _mm_cmpeq_epi16(_mm_or_si128(vx, vo), full);
+        // X over O over draw: each later test only fills lanes still 0
+        __m128i result = _mm_and_si128(draw, _mm_set1_epi16(STATUS_DRAW));
+        result = _mm_or_si128(_mm_andnot_si128(o_line, result), _mm_and_si128(o_line, _mm_set1_epi16(STATUS_O_WINS)));
+        result = _mm_or_si128(_mm_andnot_si128(x_line, result), _mm_and_si128(x_line, _mm_set1_epi16(STATUS_X_WINS)));
+        _mm_storel_epi64((__m128i*)(status + i), _mm_packus_epi16(result, zero));
+    }
+    evaluate_scalar(x + i, o + i, status + i, count - i);
+}
+
+// The same with 16 positions per step
+__attribute__((target("avx2")))
+static void evaluate_avx2(const uint16_t* x, const uint16_t* o, uint8_t* status, size_t count) {
+    const __m256i full = _mm256_set1_epi16(FULL_BOARD);
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i vx = _mm256_loadu_si256((const __m256i*)(x + i));
+        __m256i vo = _mm256_loadu_si256((const __m256i*)(o + i));
+        __m256i x_line = zero, o_line = zero;
+        for (int l = 0; l < 8; l++) {
+            __m256i mask = _mm256_set1_epi16(WIN_MASKS[l]);
+            x_line = _mm256_or_si256(x_line, _mm256_cmpeq_epi16(_mm256_and_si256(vx, mask), mask));
+            o_line = _mm256_or_si256(o_line, _mm256_cmpeq_epi16(_mm256_and_si256(vo, mask), mask));
+        }
+        __m256i draw = _mm256_cmpeq_epi16(_mm256_or_si256(vx, vo), full);
+        __m256i result = _mm256_and_si256(draw, _mm256_set1_epi16(STATUS_DRAW));
+        result = _mm256_blendv_epi8(result, _mm256_set1_epi16(STATUS_O_WINS), o_line);
+        result = _mm256_blendv_epi8(result, _mm256_set1_epi16(STATUS_X_WINS), x_line);
+        // Narrow the 16 words to bytes; packus works per 128-bit half
+        __m128i low = _mm256_castsi256_si128(result);
+        __m128i high = _mm256_extracti128_si256(result, 1);
+        _mm_storeu_si128((__m128i*)(status + i), _mm_packus_epi16(low, high));
+    }
+    evaluate_scalar(x + i, o + i, status + i, count - i);
+}
+
+#endif
+
+bool kernel_supported(BatchKernel kernel) {
+    switch (kernel) {
+        case KERNEL_SCALAR:
+            return true;
+#ifdef BATCH_X86
+        case KERNEL_SSE2:
+            return __builtin_cpu_supports("sse2");
+        case KERNEL_AVX2:
+            return __builtin_cpu_supports("avx2");
+#endif
+        default:
+            return false;
+    }
+}
+
+BatchKernel best_kernel() {
+    static const BatchKernel best = kernel_supported(KERNEL_AVX2) ? KERNEL_AVX2
+                                    : kernel_supported(KERNEL_SSE2) ? KERNEL_SSE2 : KERNEL_SCALAR;
+    return best;
+}
+
+const char* kernel_name(BatchKernel kernel) {
+    static const char* names[3] = {"scalar", "sse2", "avx2"};
+    return names[kernel];
+}
+
+void evaluate_batch(const uint16_t* x, const uint16_t* o, uint8_t* status, size_t count, BatchKernel kernel) {
+    switch (kernel) {
+#ifdef BATCH_X86
+        case KERNEL_SSE2:
+            evaluate_sse2(x, o, status, count);
+            break;
+        case KERNEL_AVX2:
+            evaluate_avx2(x, o, status, count);
+            break;
+#endif
+        default:
+            evaluate_scalar(x, o, status, count);
+            break;
+    }
+}
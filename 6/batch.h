@@ -0,0 +1,27 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include "board.h"
+
+// Batch status of classic 3x3 positions, for analytics and self-play. The
+// positions come in structure-of-arrays layout: x[i] and o[i] are the two
+// bitboards of position i, and status[i] receives its Status (board.h).
+// When both sides hold a line, X is reported, as in the solved table.
+enum BatchKernel { KERNEL_SCALAR, KERNEL_SSE2, KERNEL_AVX2 };
+
+// Function to pick the widest kernel this CPU runs
+BatchKernel best_kernel();
+
+const char* kernel_name(BatchKernel kernel);
+
+// Function to check whether the CPU can run a kernel
+bool kernel_supported(BatchKernel kernel);
+
+// Function to compute the status of count positions with a kernel the CPU
+// supports. The arrays need no particular alignment.
+void evaluate_batch(const uint16_t* x, const uint16_t* o, uint8_t* status, size_t count,
+                    BatchKernel kernel = best_kernel());
+
+#endif
@@ -0,0 +1,368 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstdint>
+#include <new>
+#include <algorithm>
+#include <cstring>
+#include <elf.h>
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "board.h"
+#include "batch.h"
+#include "game.h"
+#include "rng.h"
+#include "session.h"
+
+using namespace std;
+
+// Benchmark suite run by "make bench": latency of the board check and the
+// AI's move, game throughput, a perft count of every 3x3 game that also
+// checks the rules, heap allocations per game, and how long ttt takes from
+// exec to its first byte of output, next to the floor of any program
+// linked like tttbench (statically) and whether that ttt was linked
+// statically. The results go to a JSON file, one metric per line, so two
+// runs can be compared with diff.
+//
+//   tttbench [json] [ttt]
+
+// Every allocation of the process goes through here and is counted. Kept
+// out of line so the compiler does not pair the inlined malloc and free
+// with the library's new and delete.
+static atomic<uint64_t> allocations(0);
+
+__attribute__((noinline)) void* operator new(size_t size) {
+    allocations.fetch_add(1, memory_order_relaxed);
+    void* p = malloc(size ? size : 1);
+    if (!p) throw bad_alloc();
+    return p;
+}
+
+__attribute__((noinline)) void operator delete(void* p) noexcept {
+    free(p);
+}
+
+__attribute__((noinline)) void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+vector<pair<string, double>> results;
+
+// Function to record a metric and show it
+void report(const string& name, double value) {
+    results.push_back(make_pair(name, value));
+    cout << name << ": " << value << endl;
+}
+
+// Function to make the compiler assume the data behind p changed, so that
+// repeated passes over it are not folded into one
+static inline void clobber(const void* p) {
+    asm volatile("" : : "r"(p) : "memory");
+}
+
+double seconds_since(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// Function to pick a random legal cell for the human
+int random_move(const Game& game, Rng& rng) {
+    int cell;
+    do {
+        cell = rng.next() % game.size();
+    } while (!game.is_legal(cell));
+    return cell;
+}
+
+// Function to count the games below a position by playing every legal
+// move through Game, so the count checks the rules ttt plays by, solved
+// table included; by[0..2] collect X wins, O wins and draws
+void perft(const Game& game, uint64_t by[3]) {
+    for (int cell = 0; cell < game.size(); cell++) {
+        if (!game.is_legal(cell)) continue;
+        Game next = game;
+        switch (next.play(cell)) {
+            case RESULT_AI_WINS:
+                by[0]++;
+                break;
+            case RESULT_HUMAN_WINS:
+                by[1]++;
+                break;
+            case RESULT_DRAW:
+                by[2]++;
+                break;
+            default:
+                perft(next, by);
+        }
+    }
+}
+
+// Function to time the status check of positions from random games: the
+// move as ttt plays it (Game::play, on a copy of the position before it),
+// the bare solved-table lookup, and the batch evaluator
+void bench_check_board(const Game& prototype, Rng& rng) {
+    const size_t count = 4096;
+    const int reps = 5000;
+    vector<Game> before;
+    vector<int> last;
+    vector<uint16_t> x, o;
+    while (before.size() < count) {
+        Game game = prototype;
+        int stones = 1 + rng.next() % 9;
+        while (game.moves() < stones - 1 && game.result() == RESULT_ONGOING) {
+            game.play(random_move(game, rng));
+        }
+        if (game.result() != RESULT_ONGOING) {
+            continue;   // over before its last move
+        }
+        before.push_back(game);
+        last.push_back(random_move(game, rng));
+        game.play(last.back());
+        x.push_back(game.ai_cells());
+        o.push_back(game.human_cells());
+    }
+
+    uint64_t checksum = 0;
+    auto start = chrono::steady_clock::now();
+    for (int r = 0; r < reps; r++) {
+        for (size_t i = 0; i < count; i++) {
+            Game game = before[i];
+            checksum += game.play(last[i]);
+        }
+        clobber(before.data());
+    }
+    report("check_board_game_ns", seconds_since(start) * 1e9 / (reps * count));
+
+    start = chrono::steady_clock::now();
+    for (int r = 0; r < reps; r++) {
+        for (size_t i = 0; i < count; i++) {
+            checksum += entry_status(lookup(x[i], o[i]));
+        }
+        clobber(x.data());
+    }
+    report("check_board_table_ns", seconds_since(start) * 1e9 / (reps * count));
+
+    vector<uint8_t> status(count);
+    start = chrono::steady_clock::now();
+    for (int r = 0; r < reps; r++) {
+        evaluate_batch(x.data(), o.data(), status.data(), count);
+        checksum += status[r % count];
+    }
+    report("check_board_batch_ns", seconds_since(start) * 1e9 / (reps * count));
+    if (checksum == 42) cout << "";   // use the checksum
+}
+
+// Function to time choose_ai_move on positions reached in random games
+void bench_ai_move(const string& name, const Game& prototype, Rng& rng) {
+    vector<Game> positions;
+    while (positions.size() < 10000) {
+        Game game = prototype;
+        while (game.result() == RESULT_ONGOING) {
+            if (game.ai_to_move()) {
+                positions.push_back(game);
+                game.play(game.choose_ai_move());
+            } else {
+                game.play(random_move(game, rng));
+            }
+        }
+    }
+    const int reps = 100;
+    uint64_t checksum = 0;
+    auto start = chrono::steady_clock::now();
+    for (int r = 0; r < reps; r++) {
+        for (Game& game : positions) {
+            checksum += game.choose_ai_move();
+        }
+        clobber(positions.data());
+    }
+    report("ai_move_" + name + "_ns", seconds_since(start) * 1e9 / (reps * positions.size()));
+    if (checksum == 42) cout << "";
+}
+
+// Function to measure whole games against a random human: throughput, and
+// heap allocations per game once the game object exists
+void bench_games(const string& name, const Game& prototype, Rng& rng) {
+    const int games = 200000;
+    Game game = prototype;
+    uint64_t moves = 0;
+    uint64_t before = allocations.load();
+    auto start = chrono::steady_clock::now();
+    for (int g = 0; g < games; g++) {
+        game.reset();
+        while (game.result() == RESULT_ONGOING) {
+            game.play(game.ai_to_move() ? game.choose_ai_move() : random_move(game, rng));
+            moves++;
+        }
+    }
+    double seconds = seconds_since(start);
+    uint64_t allocated = allocations.load() - before;
+    report("games_" + name + "_per_sec", games / seconds);
+    report("moves_" + name + "_per_sec", moves / seconds);
+    report("allocations_" + name + "_per_game", (double)allocated / games);
+}
+
+// Function to count heap allocations of a whole session, output included,
+// the way the CLI runs one
+void bench_session(const string& name, const Game& prototype, ProtocolMode mode, Rng& rng) {
+    const int games = 20000;
+    string out;
+    out.reserve(4096);
+    uint64_t before = allocations.load();
+    for (int g = 0; g < games; g++) {
+        Session session(prototype, mode);
+        session.start(out);
+        while (!session.finished()) {
+            out.clear();
+            session.input(random_move(session.game(), rng) + 1, out);
+        }
+        out.clear();
+    }
+    uint64_t allocated = allocations.load() - before;
+    report("allocations_session_" + name + "_per_game", (double)allocated / games);
+}
+
+// Function to check whether the program at path is linked statically, that
+// is has no ELF interpreter to load it
+bool linked_statically(const char* path) {
+    ifstream file(path, ios::binary);
+    Elf64_Ehdr header;
+    if (!file.read((char*)&header, sizeof(header)) || memcmp(header.e_ident, ELFMAG, SELFMAG) != 0) {
+        return false;
+    }
+    for (int i = 0; i < header.e_phnum; i++) {
+        Elf64_Phdr program;
+        file.seekg(header.e_phoff + (uint64_t)i * header.e_phentsize);
+        if (!file.read((char*)&program, sizeof(program))) return false;
+        if (program.p_type == PT_INTERP) return false;
+    }
+    return true;
+}
+
+// Function to time a program from exec to the first byte it prints, runs
+// times, into micros. The program exits once its input is closed.
+bool time_first_byte(const char* program, char* const argv[], int runs, vector<double>& micros) {
+    for (int r = 0; r < runs; r++) {
+        int in[2], out[2];
+        if (pipe2(in, O_CLOEXEC) < 0 || pipe2(out, O_CLOEXEC) < 0) {
+            cout << "Cannot create pipes: " << strerror(errno) << endl;
+            return false;
+        }
+        posix_spawn_file_actions_t actions;
+        posix_spawn_file_actions_init(&actions);
+        posix_spawn_file_actions_adddup2(&actions, in[0], STDIN_FILENO);
+        posix_spawn_file_actions_adddup2(&actions, out[1], STDOUT_FILENO);
+
+        auto start = chrono::steady_clock::now();
+        pid_t pid;
+        int failed = posix_spawn(&pid, program, &actions, nullptr, argv, environ);
+        posix_spawn_file_actions_destroy(&actions);
+        close(in[0]);
+        close(out[1]);
+        char byte;
+        ssize_t n = failed ? 0 : read(out[0], &byte, 1);
+        double elapsed = seconds_since(start);
+
+        close(in[1]);       // end of input: the program exits
+        close(out[0]);
+        if (failed) {
+            cout << "Cannot run " << program << ": " << strerror(failed) << endl;
+            return false;
+        }
+        waitpid(pid, nullptr, 0);
+        if (n != 1) {
+            cout << program << " printed nothing" << endl;
+            return false;
+        }
+        micros.push_back(elapsed * 1e6);
+    }
+    sort(micros.begin(), micros.end());
+    return true;
+}
+
+// Function to time ttt from exec to the first byte of its opening board,
+// the startup mync pays on every connection, and the same for tttbench
+// printing one byte as soon as it runs: the floor exec and the loader put
+// under any program linked that way. The medians and the 99th percentiles
+// are reported, in microseconds.
+bool bench_startup(const char* ttt) {
+    const int runs = 1000;
+    char* const ttt_argv[] = {(char*)ttt, (char*)"519372846", nullptr};
+    char* const floor_argv[] = {(char*)"tttbench", (char*)"--first-byte", nullptr};
+    vector<double> micros, floor;
+    if (!time_first_byte(ttt, ttt_argv, runs, micros) || !time_first_byte("/proc/self/exe", floor_argv, runs, floor)) {
+        return false;
+    }
+    report("startup_static", linked_statically(ttt));
+    report("startup_median_us", micros[runs / 2]);
+    report("startup_p99_us", micros[runs * 99 / 100]);
+    report("startup_floor_median_us", floor[runs / 2]);
+    report("startup_floor_p99_us", floor[runs * 99 / 100]);
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    // The startup floor: bench_startup runs this binary again to print one
+    // byte and nothing else
+    if (argc == 2 && strcmp(argv[1], "--first-byte") == 0) {
+        return write(STDOUT_FILENO, "\n", 1) == 1 ? 0 : 1;
+    }
+    string path = (argc > 1) ? argv[1] : "bench.json";
+    const char* ttt = (argc > 2) ? argv[2] : "./ttt";
+    Rng rng = {1};
+
+    Strategy classic, mnk;
+    string error;
+    classic.parse_classic("519372846", error);
+    mnk.parse_mnk("25", 49, error);
+    Game strategy_game(classic, AI_STRATEGY);
+    Game perfect_game(classic, AI_PERFECT);
+    Game mnk_game(mnk, 7, 7, 5);
+
+    // Perft first: a wrong count means the rules are broken
+    uint64_t by[3] = {0, 0, 0};
+    auto start = chrono::steady_clock::now();
+    perft(strategy_game, by);
+    double seconds = seconds_since(start);
+    uint64_t total = by[0] + by[1] + by[2];
+    report("perft_games", total);
+    report("perft_ms", seconds * 1e3);
+    bool perft_ok = total == 255168 && by[0] == 131184 && by[1] == 77904 && by[2] == 46080;
+    report("perft_ok", perft_ok);
+
+    bench_check_board(strategy_game, rng);
+
+    bench_ai_move("strategy", strategy_game, rng);
+    bench_ai_move("perfect", perfect_game, rng);
+    bench_ai_move("mnk_7x7", mnk_game, rng);
+
+    bench_games("strategy", strategy_game, rng);
+    bench_games("perfect", perfect_game, rng);
+    bench_games("mnk_7x7", mnk_game, rng);
+
+    bench_session("text", perfect_game, PROTOCOL_NONE, rng);
+    bench_session("binary", perfect_game, PROTOCOL_BINARY, rng);
+    bool startup_ok = bench_startup(ttt);
+
+    ofstream out(path);
+    out << "{\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        out << "  \"" << results[i].first << "\": " << results[i].second << (i + 1 < results.size() ? "," : "")
+            << "\n";
+    }
+    out << "}\n";
+    if (!out) {
+        cout << "Cannot write " << path << endl;
+        return 1;
+    }
+    cout << "results written to " << path << endl;
+    if (!perft_ok) {
+        cout << "perft mismatch: expected 255168 games (131184 X wins, 77904 O wins, 46080 draws)" << endl;
+        return 1;
+    }
+    return startup_ok ? 0 : 1;
+}
@@ -0,0 +1,68 @@
+#ifndef BOARD_H
+#define BOARD_H
+
+#include <cstdint>
+
+// Cells are numbered 0-8 row by row; bit n of a player's mask is set when
+// that player owns cell n.
+const uint16_t FULL_BOARD = 0x1FF;
+
+// The 8 winning lines, in the order check_board reports them:
+// row i is checked before column i, then the two diagonals.
+const uint16_t WIN_MASKS[8] = {
+    0x007, 0x049,   // row 0, column 0
+    0x038, 0x092,   // row 1, column 1
+    0x1C0, 0x124,   // row 2, column 2
+    0x111, 0x054    // main diagonal, anti-diagonal
+};
+
+// SYMMETRY[s][cell] is where cell lands under symmetry s
+const int SYMMETRY[8][9] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8},  // identity
+    {6, 3, 0, 7, 4, 1, 8, 5, 2},  // rotate 90 counter-clockwise
+    {8, 7, 6, 5, 4, 3, 2, 1, 0},  // rotate 180
+    {2, 5, 8, 1, 4, 7, 0, 3, 6},  // rotate 90 clockwise
+    {2, 1, 0, 5, 4, 3, 8, 7, 6},  // mirror columns
+    {6, 7, 8, 3, 4, 5, 0, 1, 2},  // mirror rows
+    {0, 3, 6, 1, 4, 7, 2, 5, 8},  // transpose
+    {8, 5, 2, 7, 4, 1, 6, 3, 0}   // anti-transpose
+};
+
+// Function to find the first winning line fully owned by a mask (-1 if none)
+inline int find_line(uint16_t mask) {
+    for (int i = 0; i < 8; i++) {
+        if ((mask & WIN_MASKS[i]) == WIN_MASKS[i]) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Function to check whether any winning line is fully owned by a mask
+inline bool has_line(uint16_t mask) {
+    return find_line(mask) >= 0;
+}
+
+// Layout of a solved-table entry (see gentable.cpp). Positions are indexed
+// in base 3: POSITION_BASE3[x] + 2 * POSITION_BASE3[o].
+enum Status { STATUS_ONGOING, STATUS_X_WINS, STATUS_O_WINS, STATUS_DRAW };
+enum Value { VALUE_LOSS, VALUE_DRAW, VALUE_WIN };   // for the side to move
+
+const int POSITIONS = 19683;   // 3^9
+
+// Bits 0-8: optimal moves (ongoing) or winning line index (won)
+inline uint16_t entry_moves(uint16_t entry) { return entry & 0x1FF; }
+inline int entry_line(uint16_t entry) { return entry & 0x7; }
+inline Status entry_status(uint16_t entry) { return Status((entry >> 9) & 0x3); }
+inline Value entry_value(uint16_t entry) { return Value((entry >> 11) & 0x3); }
+
+// The generated tables, compiled into table.cpp
+extern const uint16_t POSITION_BASE3[512];
+extern const uint16_t SOLVED_TABLE[POSITIONS];
+
+// Function to look up the solved-table entry of a position
+inline uint16_t lookup(uint16_t x, uint16_t o) {
+    return SOLVED_TABLE[POSITION_BASE3[x] + 2 * POSITION_BASE3[o]];
+}
+
+#endif
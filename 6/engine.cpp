@@ -0,0 +1,125 @@
+#include "engine.h"
+#include "board.h"
+#include <cstring>
+
+using namespace std;
+
+const int SCORE_INF = 100;
+
+enum Bound : uint8_t { BOUND_EXACT, BOUND_LOWER, BOUND_UPPER };
+
+Negamax::Negamax() {
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    for (int p = 0; p < 2; p++) {
+        for (int c = 0; c < 9; c++) {
+            // splitmix64
+            uint64_t z = (seed += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            zobrist_[p][c] = z ^ (z >> 31);
+        }
+    }
+    for (int s = 0; s < 8; s++) {
+        for (int c = 0; c < 9; c++) {
+            inverse_symmetry_[s][SYMMETRY[s][c]] = c;
+        }
+    }
+    clear();
+}
+
+void Negamax::clear() {
+    memset(table_, 0, sizeof(table_));
+}
+
+// Function to toggle a stone of player p (0 = X, 1 = O) in every symmetric hash
+void Negamax::toggle_stone(int p, int cell) {
+    for (int s = 0; s < 8; s++) {
+        hash_[s] ^= zobrist_[p][SYMMETRY[s][cell]];
+    }
+}
+
+// Negamax score of the position for the side to move ("me"). A win is worth
+// more the earlier it happens; the stone count alone decides that, so
+// scores stay valid across transpositions.
+int Negamax::negamax(uint16_t me, uint16_t opp, int alpha, int beta) {
+    nodes_++;
+    uint16_t taken = me | opp;
+    int stones = __builtin_popcount(taken);
+    if (has_line(opp)) {
+        return -(10 - stones);
+    }
+    if (taken == FULL_BOARD) {
+        return 0;
+    }
+
+    // Canonical key: the smallest hash over the 8 symmetries
+    int sym = 0;
+    for (int s = 1; s < 8; s++) {
+        if (hash_[s] < hash_[sym]) sym = s;
+    }
+    uint64_t key = hash_[sym];
+    TTEntry& entry = table_[key & ((1 << TT_BITS) - 1)];
+    int first = -1;
+    if (entry.key == key) {
+        if (entry.bound == BOUND_EXACT) return entry.value;
+        if (entry.bound == BOUND_LOWER && entry.value >= beta) return entry.value;
+        if (entry.bound == BOUND_UPPER && entry.value <= alpha) return entry.value;
+        first = inverse_symmetry_[sym][entry.move];
+    }
+
+    int side = stones & 1;   // 0 when X is to move
+    int alpha_orig = alpha;
+    int best = -SCORE_INF;
+    int best_move = 0;
+    for (int k = -1; k < 9; k++) {
+        // Try the table move first, then the remaining cells in order
+        int cell = (k < 0) ? first : k;
+        if (cell < 0 || (k >= 0 && cell == first) || (taken & (1 << cell))) continue;
+
+        toggle_stone(side, cell);
+        int value = -negamax(opp, me | (1 << cell), -beta, -alpha);
+        toggle_stone(side, cell);
+
+        if (value > best) {
+            best = value;
+            best_move = cell;
+        }
+        if (value > alpha) alpha = value;
+        if (alpha >= beta) break;
+    }
+
+    entry.key = key;
+    entry.value = best;
+    entry.bound = (best <= alpha_orig) ? BOUND_UPPER : (best >= beta) ? BOUND_LOWER : BOUND_EXACT;
+    entry.move = SYMMETRY[sym][best_move];
+    return best;
+}
+
+int Negamax::best_move(uint16_t me, uint16_t opp, const int order[9], uint64_t& nodes) {
+    uint16_t taken = me | opp;
+    int side = __builtin_popcount(taken) & 1;
+    uint16_t x = side ? opp : me;
+    uint16_t o = side ? me : opp;
+    memset(hash_, 0, sizeof(hash_));
+    nodes_ = 0;
+    for (int c = 0; c < 9; c++) {
+        if (x & (1 << c)) toggle_stone(0, c);
+        if (o & (1 << c)) toggle_stone(1, c);
+    }
+
+    int best = -SCORE_INF;
+    int best_move = -1;
+    for (int i = 0; i < 9; i++) {
+        int cell = order[i];
+        if (taken & (1 << cell)) continue;
+        toggle_stone(side, cell);
+        int value = -negamax(opp, me | (1 << cell), -SCORE_INF, -best);
+        toggle_stone(side, cell);
+        if (value > best) {
+            best = value;
+            best_move = cell;
+        }
+    }
+    nodes += nodes_;
+    return best_move;
+}
@@ -0,0 +1,42 @@
+#ifndef ENGINE_H
+#define ENGINE_H
+
+#include <cstdint>
+
+// Perfect-play engine for the 3x3 board: negamax with alpha-beta over the
+// bitboards, a Zobrist-hashed transposition table, and positions folded over
+// the 8 board symmetries so that equivalent positions share one table entry.
+// Play goes through the solved table (see board.h); this search is what the
+// table encodes and what --bench measures. One instance per thread.
+class Negamax {
+public:
+    Negamax();
+
+    // Function to empty the transposition table
+    void clear();
+
+    // Function to pick a perfect move for the side owning "me". Among equally
+    // good moves the one earliest in order wins. Adds the nodes searched.
+    int best_move(uint16_t me, uint16_t opp, const int order[9], uint64_t& nodes);
+
+private:
+    static const int TT_BITS = 14;
+
+    struct TTEntry {
+        uint64_t key;
+        int8_t value;
+        uint8_t bound;
+        uint8_t move;   // best move, in the canonical orientation
+    };
+
+    void toggle_stone(int p, int cell);
+    int negamax(uint16_t me, uint16_t opp, int alpha, int beta);
+
+    TTEntry table_[1 << TT_BITS];
+    uint64_t zobrist_[2][9];        // [0] = X (moves first), [1] = O
+    int inverse_symmetry_[8][9];
+    uint64_t hash_[8];              // hash of the position under each symmetry
+    uint64_t nodes_;
+};
+
+#endif
@@ -0,0 +1,301 @@
+#include "game.h"
+#include "board.h"
+#include <cctype>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace std;
+
+Strategy::Strategy() {
+    first_of_[0] = -1;
+}
+
+// Function to fill the rank and first_of tables from the order
+void Strategy::index() {
+    rank_.assign(order_.size(), 0);
+    for (size_t i = 0; i < order_.size(); i++) {
+        rank_[order_[i]] = i;
+    }
+    if (order_.size() == 9) {
+        for (int cells = 1; cells < 512; cells++) {
+            int i = 0;
+            while (!(cells & (1 << order_[i]))) i++;
+            first_of_[cells] = order_[i];
+        }
+    }
+}
+
+bool Strategy::parse_classic(const string& select, string& error) {
+    // Validation: check that the input length is 9 and contains each digit 1-9 exactly once
+    if (select.length() != 9) {
+        error = "Input must be exactly 9 characters long.";
+        return false;
+    }
+
+    // One bit per digit: a repeat finds its bit already set
+    uint16_t seen = 0;
+    bool repeated = false;
+    for (char c : select) {
+        if (c < '1' || c > '9') {
+            error = "Input must contain only digits from 1 to 9.";
+            return false;
+        }
+        repeated = repeated || (seen >> (c - '1') & 1);
+        seen |= 1 << (c - '1');
+    }
+    if (repeated) {
+        error = "Each digit from 1 to 9 must appear exactly once.";
+        return false;
+    }
+
+    order_.clear();
+    for (char c : select) {
+        order_.push_back(c - '1');
+    }
+    index();
+    return true;
+}
+
+bool Strategy::parse_mnk(const string& select, int size, string& error) {
+    error = "Strategy must list distinct cells from 1 to " + to_string(size) + ", separated by commas.";
+    vector<bool> listed(size, false);
+    order_.clear();
+    size_t pos = 0;
+    while (pos < select.length()) {
+        size_t comma = select.find(',', pos);
+        if (comma == string::npos) comma = select.length();
+        string token = select.substr(pos, comma - pos);
+        if (token.empty() || token.find_first_not_of("0123456789") != string::npos ||
+            token.length() > 9) {
+            return false;
+        }
+        int num = stoi(token);
+        if (num < 1 || num > size || listed[num - 1]) {
+            return false;
+        }
+        listed[num - 1] = true;
+        order_.push_back(num - 1);
+        pos = comma + 1;
+    }
+    for (int cell = 0; cell < size; cell++) {
+        if (!listed[cell]) order_.push_back(cell);
+    }
+    index();
+    error.clear();
+    return true;
+}
+
+void unrank_permutation(uint32_t index, int order[9]) {
+    int cells[9] = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+    int left = 9;
+    uint32_t factorial = PERMUTATIONS;
+    for (int i = 0; i < 9; i++) {
+        factorial /= left;
+        int pick = index / factorial;
+        index %= factorial;
+        order[i] = cells[pick];
+        for (int k = pick; k < left - 1; k++) cells[k] = cells[k + 1];
+        left--;
+    }
+}
+
+uint32_t rank_permutation(const int order[9]) {
+    uint32_t index = 0;
+    uint32_t factorial = PERMUTATIONS;
+    for (int i = 0; i < 9; i++) {
+        factorial /= 9 - i;
+        // Position of order[i] among the cells not used yet
+        int pick = 0;
+        for (int j = i + 1; j < 9; j++) {
+            if (order[j] < order[i]) pick++;
+        }
+        index += pick * factorial;
+    }
+    return index;
+}
+
+bool parse_decimal(const char* text, uint64_t low, uint64_t high, uint64_t& value) {
+    char* end;
+    errno = 0;
+    value = strtoull(text, &end, 10);
+    return isdigit((unsigned char)text[0]) && *end == '\0' && errno != ERANGE && value >= low && value <= high;
+}
+
+uint64_t parse_argument(const char* name, const char* text, uint64_t low, uint64_t high) {
+    uint64_t value;
+    if (!parse_decimal(text, low, high, value)) {
+        printf("Invalid %s: %s (expected %" PRIu64 "-%" PRIu64 ")\n", name, text, low, high);
+        exit(1);
+    }
+    return value;
+}
+
+// Line kind of each entry of WIN_MASKS
+static const Line CLASSIC_LINES[8] = {
+    LINE_ROW, LINE_COLUMN, LINE_ROW, LINE_COLUMN, LINE_ROW, LINE_COLUMN,
+    LINE_DIAGONAL, LINE_ANTI_DIAGONAL
+};
+
+Game::Game(const Strategy& strategy, AiMode mode)
+    : strategy_(&strategy), mode_(mode), classic_(true), rows_(3), cols_(3), mnk_(0, 0, 0), mcts_(nullptr),
+      limits_(), search_(nullptr), search_limits_(), tablebase_(nullptr), policy_(nullptr) {
+    reset();
+}
+
+Game::Game(const Strategy& strategy, int rows, int cols, int k)
+    : strategy_(&strategy), mode_(AI_STRATEGY), classic_(rows == 3 && cols == 3 && k == 3),
+      rows_(rows), cols_(cols), mnk_(classic_ ? 0 : rows, classic_ ? 0 : cols, k), mcts_(nullptr), limits_(),
+      search_(nullptr), search_limits_(), tablebase_(nullptr), policy_(nullptr) {
+    reset();
+}
+
+void Game::use_mcts(Mcts* engine, const MctsLimits& limits) {
+    mode_ = AI_MCTS;
+    mcts_ = engine;
+    limits_ = limits;
+}
+
+void Game::use_search(LazySmp* engine, const SearchLimits& limits) {
+    mode_ = AI_ALPHABETA;
+    search_ = engine;
+    search_limits_ = limits;
+}
+
+void Game::use_tablebase(const Tablebase* tablebase) {
+    mode_ = AI_TABLEBASE;
+    tablebase_ = tablebase;
+}
+
+void Game::use_policy(const Policy* policy) {
+    mode_ = AI_POLICY;
+    policy_ = policy;
+}
+
+void Game::reset() {
+    moves_ = 0;
+    ai_to_move_ = true;
+    result_ = RESULT_ONGOING;
+    line_ = LINE_NONE;
+    x_ = 0;
+    o_ = 0;
+    cursor_ = 0;
+    for (int cell = 0; !classic_ && cell < size(); cell++) {
+        if (!mnk_.is_free(cell)) mnk_.undo(cell);
+    }
+}
+
+// Function to copy the classic position onto an MnkBoard for the engines
+MnkBoard Game::position() const {
+    MnkBoard board(3, 3, 3);
+    for (int cell = 0; cell < 9; cell++) {
+        if (at(cell)) board.play(cell, at(cell));
+    }
+    return board;
+}
+
+int Game::at(int cell) const {
+    if (!classic_) return mnk_.at(cell);
+    return (x_ & (1 << cell)) ? 1 : (o_ & (1 << cell)) ? -1 : 0;
+}
+
+bool Game::is_legal(int cell) const {
+    return result_ == RESULT_ONGOING && cell >= 0 && cell < size() && at(cell) == 0;
+}
+
+int Game::choose_ai_move() {
+    if (result_ != RESULT_ONGOING) return -1;
+    if (mode_ == AI_MCTS) {
+        MctsStats stats;
+        return mcts_->best_move(classic_ ? position() : mnk_, 1, limits_, stats);
+    }
+    if (mode_ == AI_ALPHABETA) {
+        SearchStats stats;
+        return search_->best_move(classic_ ? position() : mnk_, 1, search_limits_, stats);
+    }
+    if (mode_ == AI_TABLEBASE) {
+        return tablebase_->best_move(classic_ ? position() : mnk_, 1, strategy_->order());
+    }
+    if (classic_) {
+        if (mode_ == AI_PERFECT) {
+            // The side to move is always X when the AI moves, and the table
+            // lists its optimal moves
+            return strategy_->first_of(entry_moves(lookup(x_, o_)));
+        }
+        if (mode_ == AI_POLICY) {
+            int cell = policy_->move(x_, o_);
+            if (cell >= 0) return cell;
+        }
+        return strategy_->first_of(FULL_BOARD & ~(x_ | o_));
+    }
+    cursor_ = mnk_.first_free(strategy_->order(), cursor_);
+    return strategy_->at(cursor_);
+}
+
+Result Game::play(int cell) {
+    if (!is_legal(cell)) {
+        return RESULT_ILLEGAL_MOVE;
+    }
+    int player = ai_to_move_ ? 1 : -1;
+    moves_++;
+    ai_to_move_ = !ai_to_move_;
+
+    if (classic_) {
+        if (player == 1) {
+            x_ |= 1 << cell;
+        } else {
+            o_ |= 1 << cell;
+        }
+        uint16_t entry = lookup(x_, o_);
+        switch (entry_status(entry)) {
+            case STATUS_X_WINS:
+                result_ = RESULT_AI_WINS;
+                line_ = CLASSIC_LINES[entry_line(entry)];
+                break;
+            case STATUS_O_WINS:
+                result_ = RESULT_HUMAN_WINS;
+                line_ = CLASSIC_LINES[entry_line(entry)];
+                break;
+            case STATUS_DRAW:
+                result_ = RESULT_DRAW;
+                break;
+            default:
+                break;
+        }
+        return result_;
+    }
+
+    line_ = mnk_.play(cell, player);
+    if (line_ != LINE_NONE) {
+        result_ = (player == 1) ? RESULT_AI_WINS : RESULT_HUMAN_WINS;
+    } else if (mnk_.full()) {
+        result_ = RESULT_DRAW;
+    }
+    return result_;
+}
+
+string Game::render() const {
+    if (!classic_) {
+        return mnk_.render();
+    }
+    string frame;
+    int i = 1;
+    for (int row = 0; row < 3; row++) {
+        frame += "--------------\n| ";
+        for (int column = 0; column < 3; column++) {
+            int cell = at(row * 3 + column);
+            if (cell == 1) {
+                frame += "X | ";
+            } else if (cell == -1) {
+                frame += "O | ";
+            } else {
+                frame += to_string(i) + "  | ";
+            }
+            i++;
+        }
+        frame += "\n";
+    }
+    frame += "--------------\n";
+    return frame;
+}
@@ -0,0 +1,152 @@
+#ifndef GAME_H
+#define GAME_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "mnk.h"
+#include "mcts.h"
+#include "search.h"
+#include "tablebase.h"
+#include "policy.h"
+
+// Priority order in which the AI tries cells: a permutation of 1-9 for the
+// classic board, or a comma separated list of cells for m,n,k boards
+class Strategy {
+public:
+    Strategy();
+
+    // Function to parse a classic strategy string; on failure returns false
+    // and sets error to the message the CLI prints
+    bool parse_classic(const std::string& select, std::string& error);
+
+    // Function to parse an m,n,k strategy. Cells left out are tried
+    // afterwards in board order.
+    bool parse_mnk(const std::string& select, int size, std::string& error);
+
+    int size() const { return order_.size(); }
+    int at(int i) const { return order_[i]; }           // cell tried i-th
+    int rank(int cell) const { return rank_[cell]; }    // position of a cell
+    const int* order() const { return order_.data(); }
+
+    // Classic board only: the first cell of the order within a set of
+    // cells, so picking among free or optimal cells is a single lookup
+    int first_of(uint16_t cells) const { return first_of_[cells]; }
+
+private:
+    void index();
+
+    std::vector<int> order_;
+    std::vector<int> rank_;
+    int first_of_[512];
+};
+
+// Classic strategies by permutation index (0 .. 9!-1), in lexicographic
+// order of the strategy strings
+const uint32_t PERMUTATIONS = 362880;   // 9!
+
+// Function to turn a permutation index into a cell order
+void unrank_permutation(uint32_t index, int order[9]);
+
+// Function to turn a cell order into its permutation index
+uint32_t rank_permutation(const int order[9]);
+
+// Function to parse a command-line argument, all of it, as a decimal
+// number from low to high; false for anything else
+bool parse_decimal(const char* text, uint64_t low, uint64_t high, uint64_t& value);
+
+// Function to do the same for the tools: a bad argument prints what was
+// expected, naming the argument, and exits
+uint64_t parse_argument(const char* name, const char* text, uint64_t low, uint64_t high);
+
+// Outcome of a game, from the AI's side. RESULT_ILLEGAL_MOVE is only ever
+// returned by Game::play for a move it refused; the game state is unchanged.
+enum Result { RESULT_ONGOING, RESULT_AI_WINS, RESULT_HUMAN_WINS, RESULT_DRAW, RESULT_ILLEGAL_MOVE };
+
+enum AiMode { AI_STRATEGY, AI_PERFECT, AI_MCTS, AI_ALPHABETA, AI_TABLEBASE, AI_POLICY };
+
+// One game between the AI (X, moves first) and a human (O). The classic
+// 3x3 game runs on bitboards and the solved table; other sizes run on an
+// MnkBoard. The strategy must outlive the game, and may be shared by any
+// number of games.
+class Game {
+public:
+    // Classic 3x3 game
+    Game(const Strategy& strategy, AiMode mode = AI_STRATEGY);
+
+    // rows x cols board with k in a row (AI_PERFECT needs the classic board)
+    Game(const Strategy& strategy, int rows, int cols, int k);
+
+    // Function to let an MCTS engine pick the AI's moves on any board. The
+    // engine must outlive the game and may be shared by games that never
+    // search at the same time.
+    void use_mcts(Mcts* engine, const MctsLimits& limits);
+
+    // Function to do the same with the parallel alpha-beta engine
+    void use_search(LazySmp* engine, const SearchLimits& limits);
+
+    // Function to answer from a tablebase of this board's shape; ties go
+    // to the cell earliest in the strategy
+    void use_tablebase(const Tablebase* tablebase);
+
+    // Classic board only: function to play a learned policy, falling back
+    // on the strategy where the policy has no move
+    void use_policy(const Policy* policy);
+
+    // Function to start over on an empty board
+    void reset();
+
+    const Strategy& strategy() const { return *strategy_; }
+    AiMode mode() const { return mode_; }
+    bool classic() const { return classic_; }
+    int rows() const { return rows_; }
+    int cols() const { return cols_; }
+    int k() const { return classic_ ? 3 : mnk_.k(); }
+    int size() const { return rows_ * cols_; }
+    int moves() const { return moves_; }
+    bool ai_to_move() const { return ai_to_move_; }
+    Result result() const { return result_; }
+    Line line() const { return line_; }     // the completed line, once won
+
+    // 1 for the AI, -1 for the human, 0 when empty
+    int at(int cell) const;
+    bool is_legal(int cell) const;
+
+    // Function to pick the AI's next move without playing it
+    int choose_ai_move();
+
+    // Function to play a cell for the side to move
+    Result play(int cell);
+
+    // Function to render the board with free cells numbered from 1
+    std::string render() const;
+
+    // Classic board only: the two bitboards
+    uint16_t ai_cells() const { return x_; }
+    uint16_t human_cells() const { return o_; }
+
+private:
+    MnkBoard position() const;
+
+    const Strategy* strategy_;
+    AiMode mode_;
+    bool classic_;
+    int rows_;
+    int cols_;
+    int moves_;
+    bool ai_to_move_;
+    Result result_;
+    Line line_;
+    uint16_t x_;            // classic board: AI stones
+    uint16_t o_;            // classic board: human stones
+    MnkBoard mnk_;          // any other board
+    int cursor_;            // cells before it in the order are all taken
+    Mcts* mcts_;
+    MctsLimits limits_;
+    LazySmp* search_;
+    SearchLimits search_limits_;
+    const Tablebase* tablebase_;
+    const Policy* policy_;
+};
+
+#endif
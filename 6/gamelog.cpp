@@ -0,0 +1,215 @@
+#include "gamelog.h"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+
+static_assert(sizeof(GameRecord) == 16, "game records are 16 bytes on disk");
+static_assert(sizeof(GameLogHeader) == 16, "the header keeps records 16-byte aligned");
+
+GameRecord make_record(const Strategy& strategy, bool perfect, const int* moves, int count, Result result,
+                       uint32_t start, uint32_t duration_ms) {
+    uint64_t word = 0;
+    for (int i = 0; i < count; i++) {
+        word |= (uint64_t)moves[i] << (4 * i);
+    }
+    word |= (uint64_t)count << 36;
+    word |= (uint64_t)rank_permutation(strategy.order()) << 40;
+    word |= (uint64_t)result << 59;
+    word |= (uint64_t)perfect << 61;
+    GameRecord record = {word, start, duration_ms};
+    return record;
+}
+
+// Function to check the header at the start of an open log
+static bool check_header(int fd) {
+    GameLogHeader header;
+    if (pread(fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header)) return false;
+    return memcmp(header.magic, "TTTL", 4) == 0 && header.version == GAMELOG_VERSION &&
+           header.record_size == sizeof(GameRecord);
+}
+
+// ---------------------------------------------------------------------------
+// Writer
+// ---------------------------------------------------------------------------
+
+GameLogWriter::GameLogWriter() : fd_(-1), pending_(0) {
+}
+
+GameLogWriter::~GameLogWriter() {
+    flush();
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+}
+
+bool GameLogWriter::open(const string& path, string& error) {
+    int fd = ::open(path.c_str(), O_WRONLY | O_APPEND | O_CLOEXEC);
+    if (fd < 0 && errno == ENOENT) {
+        // Build the header in a private file and link it into place, so no
+        // process ever sees the log without its header. If another process
+        // got there first, its file is used.
+        string temp = path + ".XXXXXX";
+        int temp_fd = mkstemp(&temp[0]);
+        if (temp_fd < 0) {
+            error = "Cannot create " + path + ": " + strerror(errno);
+            return false;
+        }
+        GameLogHeader header = {{'T', 'T', 'T', 'L'}, GAMELOG_VERSION, sizeof(GameRecord), 0};
+        fchmod(temp_fd, 0644);
+        bool written = write(temp_fd, &header, sizeof(header)) == (ssize_t)sizeof(header);
+        close(temp_fd);
+        if (!written || (link(temp.c_str(), path.c_str()) < 0 && errno != EEXIST)) {
+            error = "Cannot create " + path + ": " + strerror(errno);
+            unlink(temp.c_str());
+            return false;
+        }
+        unlink(temp.c_str());
+        fd = ::open(path.c_str(), O_WRONLY | O_APPEND | O_CLOEXEC);
+    }
+    if (fd < 0) {
+        error = "Cannot open " + path + ": " + strerror(errno);
+        return false;
+    }
+
+    int check = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    bool valid = check >= 0 && check_header(check);
+    if (check >= 0) close(check);
+    if (!valid) {
+        error = "Not a game log: " + path;
+        close(fd);
+        return false;
+    }
+
+    flush();
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+    fd_ = fd;
+    return true;
+}
+
+void GameLogWriter::append(const GameRecord& record) {
+    buffer_[pending_++] = record;
+    if (pending_ == BUFFER) {
+        flush();
+    }
+}
+
+void GameLogWriter::flush() {
+    if (fd_ >= 0 && pending_ > 0) {
+        const char* data = (const char*)buffer_;
+        size_t left = pending_ * sizeof(GameRecord);
+        while (left > 0) {
+            ssize_t n = write(fd_, data, left);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                break;      // a full disk loses the batch, not the game
+            }
+            data += n;
+            left -= n;
+        }
+    }
+    pending_ = 0;
+}
+
+// ---------------------------------------------------------------------------
+// Streaming reader
+// ---------------------------------------------------------------------------
+
+GameLogReader::GameLogReader() : fd_(-1), count_(0), position_(0) {
+}
+
+GameLogReader::~GameLogReader() {
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+}
+
+bool GameLogReader::open(const string& path, string& error) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        error = "Cannot open " + path + ": " + strerror(errno);
+        return false;
+    }
+    if (!check_header(fd) || lseek(fd, sizeof(GameLogHeader), SEEK_SET) < 0) {
+        error = "Not a game log: " + path;
+        close(fd);
+        return false;
+    }
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+    fd_ = fd;
+    count_ = 0;
+    position_ = 0;
+    return true;
+}
+
+bool GameLogReader::next(GameRecord& record) {
+    if (position_ == count_) {
+        if (fd_ < 0) return false;
+        // Read whole records only; a torn record at the end is dropped
+        char* data = (char*)buffer_;
+        size_t filled = 0;
+        while (filled < sizeof(buffer_)) {
+            ssize_t n = read(fd_, data + filled, sizeof(buffer_) - filled);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) break;
+            filled += n;
+        }
+        count_ = filled / sizeof(GameRecord);
+        position_ = 0;
+        if (count_ == 0) return false;
+    }
+    record = buffer_[position_++];
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Mapped reader
+// ---------------------------------------------------------------------------
+
+GameLogMap::GameLogMap() : map_(nullptr), length_(0), records_(nullptr), count_(0) {
+}
+
+GameLogMap::~GameLogMap() {
+    if (map_) {
+        munmap(map_, length_);
+    }
+}
+
+bool GameLogMap::open(const string& path, string& error) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        error = "Cannot open " + path + ": " + strerror(errno);
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) < 0 || !check_header(fd)) {
+        error = "Not a game log: " + path;
+        close(fd);
+        return false;
+    }
+    void* map = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        error = "Cannot map " + path + ": " + strerror(errno);
+        return false;
+    }
+    madvise(map, st.st_size, MADV_SEQUENTIAL);
+
+    if (map_) {
+        munmap(map_, length_);
+    }
+    map_ = map;
+    length_ = st.st_size;
+    records_ = (const GameRecord*)((const char*)map + sizeof(GameLogHeader));
+    count_ = (length_ - sizeof(GameLogHeader)) / sizeof(GameRecord);
+    return true;
+}
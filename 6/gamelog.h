@@ -0,0 +1,114 @@
+#ifndef GAMELOG_H
+#define GAMELOG_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "game.h"
+
+// Binary log of finished classic games: a GameLogHeader, then fixed-size
+// 16-byte records, so record i sits at a known offset and a mapped file
+// can be indexed directly. A record's word holds, from bit 0:
+//   0-35   the moves, 4 bits each (cells 0-8), first move lowest
+//   36-39  the number of moves
+//   40-58  the strategy, as its permutation index
+//   59-60  the result, from the AI's side
+//   61     the AI mode: 0 strategy, 1 perfect
+struct GameRecord {
+    uint64_t word;
+    uint32_t start;         // unix seconds
+    uint32_t duration_ms;
+
+    int moves() const { return (word >> 36) & 0xF; }
+    int move(int i) const { return (word >> (4 * i)) & 0xF; }
+    uint32_t strategy() const { return (word >> 40) & 0x7FFFF; }
+    Result result() const { return Result((word >> 59) & 0x3); }
+    bool perfect() const { return (word >> 61) & 1; }
+};
+
+// Function to pack a record; moves are cells 0-8, at most 9 of them
+GameRecord make_record(const Strategy& strategy, bool perfect, const int* moves, int count, Result result,
+                       uint32_t start, uint32_t duration_ms);
+
+struct GameLogHeader {
+    char magic[4];          // "TTTL"
+    uint32_t version;
+    uint32_t record_size;
+    uint32_t reserved;
+};
+
+const uint32_t GAMELOG_VERSION = 1;
+
+// Appends records to a log, creating it with its header if needed. Records
+// are buffered and written 256 at a time (or on flush), each batch with
+// one O_APPEND write, so processes sharing a log never interleave inside
+// a record.
+class GameLogWriter {
+public:
+    GameLogWriter();
+    ~GameLogWriter();   // flushes
+    GameLogWriter(const GameLogWriter&) = delete;
+    GameLogWriter& operator=(const GameLogWriter&) = delete;
+
+    // Function to open or create a log; on failure returns false and sets
+    // error to the message the CLI prints
+    bool open(const std::string& path, std::string& error);
+
+    void append(const GameRecord& record);
+
+    // Function to write out the buffered records
+    void flush();
+
+private:
+    static const int BUFFER = 256;
+
+    int fd_;
+    int pending_;
+    GameRecord buffer_[BUFFER];
+};
+
+// Reads a log front to back through a fixed buffer
+class GameLogReader {
+public:
+    GameLogReader();
+    ~GameLogReader();
+    GameLogReader(const GameLogReader&) = delete;
+    GameLogReader& operator=(const GameLogReader&) = delete;
+
+    bool open(const std::string& path, std::string& error);
+
+    // Function to fetch the next record; false at the end of the log
+    bool next(GameRecord& record);
+
+private:
+    static const int BUFFER = 4096;
+
+    int fd_;
+    size_t count_;
+    size_t position_;
+    GameRecord buffer_[BUFFER];
+};
+
+// Read-only mapping of a whole log, for random access and parallel scans
+class GameLogMap {
+public:
+    GameLogMap();
+    ~GameLogMap();
+    GameLogMap(const GameLogMap&) = delete;
+    GameLogMap& operator=(const GameLogMap&) = delete;
+
+    bool open(const std::string& path, std::string& error);
+
+    size_t size() const { return count_; }
+    const GameRecord& operator[](size_t i) const { return records_[i]; }
+    const GameRecord* begin() const { return records_; }
+    const GameRecord* end() const { return records_ + count_; }
+
+private:
+    void* map_;
+    size_t length_;
+    const GameRecord* records_;
+    size_t count_;
+};
+
+#endif
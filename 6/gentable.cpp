@@ -0,0 +1,85 @@
+#include <iostream>
+#include <vector>
+#include <cstdint>
+#include "board.h"
+
+using namespace std;
+
+// Generates ttt_table.h: every reachable position solved by full minimax,
+// with its status, its value for the side to move and the set of moves that
+// reach that value. Scores prefer earlier wins and later losses, the same
+// ordering the negamax engine in ttt.cpp uses.
+
+uint16_t base3[512];
+vector<uint16_t> table(POSITIONS);
+vector<int8_t> score(POSITIONS);
+vector<bool> solved(POSITIONS);
+
+int solve(uint16_t x, uint16_t o) {
+    int index = base3[x] + 2 * base3[o];
+    if (solved[index]) {
+        return score[index];
+    }
+    solved[index] = true;
+
+    uint16_t taken = x | o;
+    int stones = __builtin_popcount(taken);
+    int x_line = find_line(x);
+    int o_line = find_line(o);
+    if (x_line >= 0 || o_line >= 0) {
+        // The side that just moved has won
+        Status status = (x_line >= 0) ? STATUS_X_WINS : STATUS_O_WINS;
+        table[index] = (status << 9) | (x_line >= 0 ? x_line : o_line);
+        score[index] = -(10 - stones);
+        return score[index];
+    }
+    if (taken == FULL_BOARD) {
+        table[index] = STATUS_DRAW << 9;
+        score[index] = 0;
+        return 0;
+    }
+
+    bool x_to_move = (stones % 2 == 0);
+    int best = -100;
+    uint16_t best_moves = 0;
+    for (int cell = 0; cell < 9; cell++) {
+        uint16_t bit = 1 << cell;
+        if (taken & bit) continue;
+        int value = x_to_move ? -solve(x | bit, o) : -solve(x, o | bit);
+        if (value > best) {
+            best = value;
+            best_moves = bit;
+        } else if (value == best) {
+            best_moves |= bit;
+        }
+    }
+    Value value = (best > 0) ? VALUE_WIN : (best < 0) ? VALUE_LOSS : VALUE_DRAW;
+    table[index] = (value << 11) | (STATUS_ONGOING << 9) | best_moves;
+    score[index] = best;
+    return best;
+}
+
+int main() {
+    for (int mask = 0; mask < 512; mask++) {
+        int power = 1;
+        for (int cell = 0; cell < 9; cell++) {
+            if (mask & (1 << cell)) base3[mask] += power;
+            power *= 3;
+        }
+    }
+    solve(0, 0);
+
+    cout << "// Generated by gentable - do not edit.\n";
+    cout << "#ifndef TTT_TABLE_H\n#define TTT_TABLE_H\n\n#include <cstdint>\n\n";
+    cout << "const uint16_t POSITION_BASE3[512] = {";
+    for (int i = 0; i < 512; i++) {
+        cout << (i % 16 ? " " : "\n    ") << base3[i] << ",";
+    }
+    cout << "\n};\n\n";
+    cout << "const uint16_t SOLVED_TABLE[" << POSITIONS << "] = {";
+    for (int i = 0; i < POSITIONS; i++) {
+        cout << (i % 16 ? " " : "\n    ") << table[i] << ",";
+    }
+    cout << "\n};\n\n#endif\n";
+    return 0;
+}
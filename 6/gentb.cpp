@@ -0,0 +1,203 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <cstring>
+#include <cstdint>
+#include "game.h"
+#include "tablebase.h"
+
+using namespace std;
+
+// Writes the tablebase of a small m,n,k board by retrograde analysis. A
+// move always adds a stone, so the positions with n stones depend only on
+// those with n + 1: the layers are solved from the full board back to the
+// empty one, each split across threads in chunks of positions.
+
+const size_t CHUNK = 4096;
+const unsigned MAX_THREADS = 256;
+
+int rows, cols, k, cells;
+vector<uint32_t> lines;             // every k-in-a-row, as a cell mask
+vector<uint64_t> powers;
+vector<uint8_t> table;
+vector<vector<uint32_t>> layers;    // legal positions by stone count
+
+// Function to check whether a mask of cells holds a line
+bool has_line(uint32_t mask) {
+    for (uint32_t line : lines) {
+        if ((mask & line) == line) return true;
+    }
+    return false;
+}
+
+// Function to list the lines of the board in all 4 directions
+void make_lines() {
+    static const int directions[4][2] = {{0, 1}, {1, 0}, {1, 1}, {1, -1}};
+    for (int d = 0; d < 4; d++) {
+        for (int row = 0; row < rows; row++) {
+            for (int col = 0; col < cols; col++) {
+                int end_row = row + (k - 1) * directions[d][0];
+                int end_col = col + (k - 1) * directions[d][1];
+                if (end_row < 0 || end_row >= rows || end_col < 0 || end_col >= cols) continue;
+                uint32_t line = 0;
+                for (int i = 0; i < k; i++) {
+                    line |= 1u << ((row + i * directions[d][0]) * cols + col + i * directions[d][1]);
+                }
+                lines.push_back(line);
+            }
+        }
+    }
+}
+
+// Function to sort every position with as many X as O stones, or one more,
+// into its layer
+void enumerate() {
+    layers.assign(cells + 1, vector<uint32_t>());
+    vector<int> digits(cells, 0);
+    int x = 0, o = 0;
+    for (uint64_t index = 0; index < table.size(); index++) {
+        if (x == o || x == o + 1) {
+            layers[x + o].push_back(index);
+        }
+        // Step the base 3 counter, keeping the stone counts
+        for (int i = 0; i < cells; i++) {
+            if (digits[i] == 1) x--;
+            if (digits[i] == 2) o--;
+            digits[i] = (digits[i] + 1) % 3;
+            if (digits[i] == 1) x++;
+            if (digits[i] == 2) o++;
+            if (digits[i] != 0) break;
+        }
+    }
+}
+
+// Function to solve one position from its already solved children
+uint8_t solve(uint32_t index, int stones) {
+    uint32_t x = 0, o = 0;
+    uint32_t rest = index;
+    for (int cell = 0; cell < cells; cell++) {
+        int digit = rest % 3;
+        rest /= 3;
+        if (digit == 1) x |= 1u << cell;
+        if (digit == 2) o |= 1u << cell;
+    }
+    bool x_to_move = (stones % 2 == 0);
+    bool mover_line = has_line(x_to_move ? x : o);
+    bool last_line = has_line(x_to_move ? o : x);
+    if (mover_line) {
+        return tb_entry(TB_NONE, 0);    // the game ended before this
+    }
+    if (last_line) {
+        return tb_entry(TB_LOSS, 0);
+    }
+    if (stones == cells) {
+        return tb_entry(TB_DRAW, 0);
+    }
+
+    uint64_t digit = x_to_move ? 1 : 2;
+    int win = -1, draw = -1, loss = -1;     // best distance of each kind
+    for (int cell = 0; cell < cells; cell++) {
+        if ((x | o) >> cell & 1) continue;
+        uint8_t child = table[index + digit * powers[cell]];
+        int distance = tb_distance(child) + 1;
+        switch (tb_value(child)) {
+            case TB_LOSS:
+                if (win < 0 || distance < win) win = distance;
+                break;
+            case TB_DRAW:
+                if (draw < 0 || distance > draw) draw = distance;
+                break;
+            case TB_WIN:
+                if (distance > loss) loss = distance;
+                break;
+            default:
+                break;
+        }
+    }
+    if (win >= 0) return tb_entry(TB_WIN, win);
+    if (draw >= 0) return tb_entry(TB_DRAW, draw);
+    return tb_entry(TB_LOSS, loss);
+}
+
+// Function to solve a layer with every thread pulling chunks of positions
+void solve_layer(int stones, unsigned threads) {
+    const vector<uint32_t>& layer = layers[stones];
+    atomic<size_t> next(0);
+    auto work = [&]() {
+        size_t begin;
+        while ((begin = next.fetch_add(CHUNK)) < layer.size()) {
+            size_t end = min(begin + CHUNK, layer.size());
+            for (size_t i = begin; i < end; i++) {
+                table[layer[i]] = solve(layer[i], stones);
+            }
+        }
+    };
+    vector<thread> workers;
+    for (unsigned t = 1; t < threads; t++) {
+        workers.push_back(thread(work));
+    }
+    work();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 4 && argc != 5) {
+        cout << "Usage: " << argv[0] << " <rows>x<cols> <k> <file> [threads]" << endl;
+        return 1;
+    }
+    // Each side is range checked before the product is taken
+    string size = argv[1];
+    size_t sep = size.find('x');
+    rows = parse_argument("row count", size.substr(0, sep).c_str(), 1, TB_MAX_CELLS);
+    cols = (sep == string::npos) ? rows : parse_argument("column count", size.substr(sep + 1).c_str(), 1, TB_MAX_CELLS);
+    if (rows * cols > TB_MAX_CELLS) {
+        cout << "Invalid board size (at most " << TB_MAX_CELLS << " cells)." << endl;
+        return 1;
+    }
+    cells = rows * cols;
+    k = parse_argument("k", argv[2], 1, max(rows, cols));
+    unsigned threads = (argc == 5) ? parse_argument("thread count", argv[4], 1, MAX_THREADS)
+                                   : min(max(1U, thread::hardware_concurrency()), MAX_THREADS);
+
+    auto start = chrono::steady_clock::now();
+    make_lines();
+    uint64_t positions = 1;
+    for (int i = 0; i < cells; i++) {
+        powers.push_back(positions);
+        positions *= 3;
+    }
+    table.assign(positions, tb_entry(TB_NONE, 0));
+    enumerate();
+    for (int stones = cells; stones >= 0; stones--) {
+        solve_layer(stones, threads);
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    TablebaseHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, "TTTB", 4);
+    header.version = TB_VERSION;
+    header.rows = rows;
+    header.cols = cols;
+    header.k = k;
+    header.positions = positions;
+    ofstream out(argv[3], ios::binary);
+    out.write((const char*)&header, sizeof(header));
+    out.write((const char*)table.data(), table.size());
+    if (!out) {
+        cout << "Cannot write " << argv[3] << endl;
+        return 1;
+    }
+
+    uint8_t root = table[0];
+    static const char* values[4] = {"none", "loss", "draw", "win"};
+    cout << rows << "x" << cols << " k=" << k << ": " << positions << " positions, threads: " << threads
+         << ", seconds: " << seconds << ", first player: " << values[tb_value(root)]
+         << " in " << tb_distance(root) << " plies" << endl;
+    return 0;
+}
@@ -0,0 +1,135 @@
+#include "latency.h"
+#include <cerrno>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+
+using namespace std;
+
+bool latency_enabled = false;
+Histogram LATENCY[PROBES];
+
+static const char* const PROBE_NAMES[PROBES] = {"ai_move", "check_board", "input_wait", "render", "flush"};
+
+// Where the report goes, and the two clocks at the start, which give the
+// tick rate when the report is written
+static int report_fd = STDERR_FILENO;
+static uint64_t start_ticks;
+static uint64_t start_ns;
+
+uint64_t Histogram::percentile(double p) const {
+    if (count_ == 0) return 0;
+    uint64_t rank = (uint64_t)(p * count_);
+    if (rank >= count_) rank = count_ - 1;
+    uint64_t seen = 0;
+    for (int b = 0; b < BUCKETS; b++) {
+        seen += buckets_[b];
+        if (seen > rank) {
+            if (b < 16) return b;
+            int power = (b - 16) / 8 + 4;
+            uint64_t low = (8ULL + (b - 16) % 8) << (power - 3);
+            uint64_t middle = low + (1ULL << (power - 4));
+            return middle < max_ ? middle : max_;
+        }
+    }
+    return max_;
+}
+
+// Function to read the monotonic clock in nanoseconds
+static uint64_t monotonic_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// Function to append a number right-aligned in a field, without allocating
+// (the report may be written from a signal handler)
+static char* append_number(char* out, uint64_t value, int width) {
+    char digits[20];
+    int length = 0;
+    do {
+        digits[length++] = '0' + value % 10;
+        value /= 10;
+    } while (value);
+    for (int i = length; i < width; i++) *out++ = ' ';
+    while (length) *out++ = digits[--length];
+    return out;
+}
+
+static char* append_text(char* out, const char* text, int width) {
+    int length = strlen(text);
+    memcpy(out, text, length);
+    for (int i = length; i < width; i++) out[i] = ' ';
+    return out + (length > width ? length : width);
+}
+
+void report_latency() {
+    // Measure the tick rate over at least a millisecond
+    uint64_t now_ns = monotonic_ns();
+    while (now_ns - start_ns < 1000000) now_ns = monotonic_ns();
+    double ns_per_tick = (double)(now_ns - start_ns) / (ticks() - start_ticks);
+
+    char report[128 * (PROBES + 1)];
+    char* out = append_text(report, "latency (ns)", 12);
+    static const char* const COLUMNS[] = {"count", "p50", "p99", "p999", "max"};
+    for (const char* column : COLUMNS) {
+        *out++ = ' ';
+        out = append_text(out, "", 12 - strlen(column));
+        out = append_text(out, column, 0);
+    }
+    *out++ = '\n';
+    for (int p = 0; p < PROBES; p++) {
+        const Histogram& histogram = LATENCY[p];
+        out = append_text(out, PROBE_NAMES[p], 12);
+        out = append_number(out, histogram.count(), 13);
+        out = append_number(out, histogram.percentile(0.5) * ns_per_tick, 13);
+        out = append_number(out, histogram.percentile(0.99) * ns_per_tick, 13);
+        out = append_number(out, histogram.percentile(0.999) * ns_per_tick, 13);
+        out = append_number(out, histogram.max() * ns_per_tick, 13);
+        *out++ = '\n';
+    }
+
+    const char* data = report;
+    while (data < out) {
+        ssize_t n = write(report_fd, data, out - data);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        data += n;
+    }
+}
+
+static void report_at_exit() {
+    report_latency();
+}
+
+static void report_handler(int signum) {
+    int saved = errno;
+    report_latency();
+    if (signum != SIGUSR1) {
+        signal(signum, SIG_DFL);
+        raise(signum);
+    }
+    errno = saved;
+}
+
+bool enable_latency(const string& path, string& error) {
+    if (!path.empty()) {
+        int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_APPEND | O_CLOEXEC, 0644);
+        if (fd < 0) {
+            error = "Cannot open " + path + ": " + strerror(errno);
+            return false;
+        }
+        report_fd = fd;
+    }
+    start_ns = monotonic_ns();
+    start_ticks = ticks();
+    latency_enabled = true;
+    atexit(report_at_exit);
+    signal(SIGUSR1, report_handler);
+    signal(SIGINT, report_handler);
+    signal(SIGTERM, report_handler);
+    return true;
+}
@@ -0,0 +1,93 @@
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include <cstdint>
+#include <string>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <time.h>
+#endif
+
+// Optional per-move latency histograms. Each probe times one stage of a
+// move with the CPU's time-stamp counter (assumed invariant, as on every
+// x86 of the last decade) and adds the duration to a log-bucketed
+// histogram. The histograms are plain counters, recorded from the thread
+// that runs the sessions, and cost one branch per probe while disabled.
+enum Probe { PROBE_AI_MOVE, PROBE_CHECK_BOARD, PROBE_INPUT_WAIT, PROBE_RENDER, PROBE_FLUSH, PROBES };
+
+// Function to read the tick counter: the TSC on x86, nanoseconds elsewhere
+inline uint64_t ticks() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+#endif
+}
+
+// Durations in ticks, bucketed by power of two with 8 linear steps within
+// each power, so a reported percentile is within 12.5% of the real one
+class Histogram {
+public:
+    static const int BUCKETS = 16 + 60 * 8;
+
+    constexpr Histogram() : count_(0), max_(0), buckets_() {}
+
+    void record(uint64_t duration) {
+        count_++;
+        if (duration > max_) max_ = duration;
+        buckets_[bucket(duration)]++;
+    }
+
+    uint64_t count() const { return count_; }
+    uint64_t max() const { return max_; }
+
+    // Function to find the duration below which a fraction p of the samples
+    // fall, as the middle of its bucket
+    uint64_t percentile(double p) const;
+
+private:
+    static int bucket(uint64_t duration) {
+        if (duration < 16) return duration;
+        int power = 63 - __builtin_clzll(duration);
+        return 16 + (power - 4) * 8 + ((duration >> (power - 3)) & 7);
+    }
+
+    uint64_t count_;
+    uint64_t max_;
+    uint64_t buckets_[BUCKETS];
+};
+
+extern bool latency_enabled;
+extern Histogram LATENCY[PROBES];
+
+// Function to start timing, and to report on exit and on SIGUSR1. SIGINT
+// and SIGTERM report and then exit, unless something installs its own
+// handlers later (the server does, and reports on its way out). The
+// report goes to path, or to stderr when path is empty; on failure returns
+// false and sets error to the message the CLI prints.
+bool enable_latency(const std::string& path, std::string& error);
+
+// Function to write the report now; safe to call from a signal handler
+void report_latency();
+
+// Times the rest of its scope into one histogram
+class LatencyTimer {
+public:
+    explicit LatencyTimer(Probe probe) : probe_(probe), start_(latency_enabled ? ticks() : 0) {
+    }
+
+    ~LatencyTimer() {
+        if (latency_enabled) {
+            LATENCY[probe_].record(ticks() - start_);
+        }
+    }
+
+private:
+    Probe probe_;
+    uint64_t start_;
+};
+
+#endif
@@ -0,0 +1,275 @@
+#include "mcts.h"
+#include "rng.h"
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+const int32_t UNEXPANDED = -1;
+const int32_t EXPANDING = -2;
+const double EXPLORATION = 1.41421356;   // UCT constant, sqrt(2)
+const int EXPAND_AFTER = 2;              // visits before a leaf grows children
+
+static int64_t now_ns() {
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Function to play random moves to the end of the game; returns the winner
+// (0 for a draw) and records the moves so they can be taken back
+static int playout(MnkBoard& board, int to_move, Rng& rng, vector<int>& moves, vector<int>& played) {
+    moves.resize(board.size());
+    moves.resize(board.legal_moves(moves.data()));
+    while (!moves.empty()) {
+        size_t pick = rng.next() % moves.size();
+        int cell = moves[pick];
+        moves[pick] = moves.back();
+        moves.pop_back();
+        played.push_back(cell);
+        if (board.play(cell, to_move) != LINE_NONE) {
+            return to_move;
+        }
+        to_move = -to_move;
+    }
+    return 0;
+}
+
+static int playout(UltimateBoard& board, int to_move, Rng& rng, vector<int>&, vector<int>& played) {
+    while (!board.full()) {
+        // Pick among the open cells of all open boards
+        uint16_t boards = board.open_boards();
+        int count = 0;
+        for (uint16_t b = boards; b; b &= b - 1) {
+            count += __builtin_popcount(board.open_cells(__builtin_ctz(b)));
+        }
+        int pick = rng.next() % count;
+        int b = __builtin_ctz(boards);
+        while (pick >= __builtin_popcount(board.open_cells(b))) {
+            pick -= __builtin_popcount(board.open_cells(b));
+            boards &= boards - 1;
+            b = __builtin_ctz(boards);
+        }
+        uint16_t cells = board.open_cells(b);
+        while (pick--) cells &= cells - 1;
+        int move = b * 9 + __builtin_ctz(cells);
+        played.push_back(move);
+        if (board.play(move, to_move)) {
+            return to_move;
+        }
+        to_move = -to_move;
+    }
+    return 0;
+}
+
+// Function to find a move that wins on the spot, or on an m,n,k board one
+// that stops the opponent from doing so (-1 if none)
+static int tactical_move(const MnkBoard& board, int player) {
+    MnkBoard probe = board;
+    for (int side = 0; side < 2; side++) {
+        for (int cell = 0; cell < probe.size(); cell++) {
+            if (!probe.is_free(cell)) continue;
+            Line line = probe.play(cell, side == 0 ? player : -player);
+            probe.undo(cell);
+            if (line != LINE_NONE) return cell;
+        }
+    }
+    return -1;
+}
+
+static int tactical_move(const UltimateBoard& board, int player) {
+    // The opponent's reply depends on where our move sends them, so only
+    // an immediate win is taken without searching
+    UltimateBoard probe = board;
+    int moves[81];
+    int count = probe.legal_moves(moves);
+    for (int i = 0; i < count; i++) {
+        bool won = probe.play(moves[i], player);
+        probe.undo(moves[i]);
+        if (won) return moves[i];
+    }
+    return -1;
+}
+
+Mcts::Mcts(uint32_t max_nodes)
+    : pool_(new Node[max_nodes]), max_nodes_(max_nodes), next_node_(0), iterations_(0), stop_(false), deadline_(0) {
+}
+
+void Mcts::init_node(uint32_t index, int move) {
+    Node& node = pool_[index];
+    node.visits.store(0, memory_order_relaxed);
+    node.score.store(0, memory_order_relaxed);
+    node.first_child.store(UNEXPANDED, memory_order_relaxed);
+    node.children = 0;
+    node.move = move;
+}
+
+// Function to pick the child with the best UCT score; unvisited children first
+uint32_t Mcts::select_child(const Node& node) const {
+    uint32_t first = node.first_child.load(memory_order_acquire);
+    double log_parent = log((double)node.visits.load(memory_order_relaxed) + 1);
+    uint32_t best = first;
+    double best_score = -1;
+    for (uint32_t c = first; c < first + node.children; c++) {
+        int32_t visits = pool_[c].visits.load(memory_order_relaxed);
+        if (visits == 0) {
+            return c;
+        }
+        double value = pool_[c].score.load(memory_order_relaxed) / (2.0 * visits);
+        double score = value + EXPLORATION * sqrt(log_parent / visits);
+        if (score > best_score) {
+            best_score = score;
+            best = c;
+        }
+    }
+    return best;
+}
+
+// Function run by every search thread: descend, expand, play out, back up
+template <class Board>
+void Mcts::search(const Board& root, int player, const MctsLimits& limits, uint64_t seed, uint64_t& playouts) {
+    Board board = root;
+    Rng rng = {seed};
+    vector<uint32_t> path;
+    vector<int> played;
+    vector<int> moves(board.size());
+    uint64_t done = 0;
+
+    while (!stop_.load(memory_order_relaxed)) {
+        if (limits.iterations && iterations_.fetch_add(1, memory_order_relaxed) >= limits.iterations) {
+            break;
+        }
+        if ((done & 63) == 0 && limits.milliseconds && now_ns() >= deadline_) {
+            break;
+        }
+
+        path.clear();
+        played.clear();
+        uint32_t index = 0;
+        int to_move = player;
+        int winner = 0;
+        bool over = false;
+        pool_[0].visits.fetch_add(1, memory_order_relaxed);
+        path.push_back(0);
+
+        // Selection and expansion
+        while (true) {
+            Node& node = pool_[index];
+            int32_t first = node.first_child.load(memory_order_acquire);
+            if (first == UNEXPANDED && (index == 0 || node.visits.load(memory_order_relaxed) >= EXPAND_AFTER)) {
+                int32_t expected = UNEXPANDED;
+                if (node.first_child.compare_exchange_strong(expected, EXPANDING, memory_order_acq_rel)) {
+                    int count = board.legal_moves(moves.data());
+                    uint32_t start = next_node_.fetch_add(count, memory_order_relaxed);
+                    if (start + count > max_nodes_) {
+                        // Pool exhausted: this node stays a leaf for good
+                        next_node_.fetch_sub(count, memory_order_relaxed);
+                    } else {
+                        for (int i = 0; i < count; i++) {
+                            init_node(start + i, moves[i]);
+                        }
+                        node.children = count;
+                        node.first_child.store(start, memory_order_release);
+                        first = start;
+                    }
+                }
+            }
+            if (first < 0) {
+                break;   // leaf, or another thread is expanding it
+            }
+
+            index = select_child(node);
+            Node& child = pool_[index];
+            child.visits.fetch_add(1, memory_order_relaxed);   // virtual loss until the score is in
+            path.push_back(index);
+            played.push_back(child.move);
+            if (board.play(child.move, to_move)) {
+                winner = to_move;
+                over = true;
+                break;
+            }
+            if (board.full()) {
+                over = true;
+                break;
+            }
+            to_move = -to_move;
+        }
+
+        // Random playout
+        if (!over) {
+            winner = playout(board, to_move, rng, moves, played);
+        }
+
+        // Backpropagation: the node reached by a move of mover scores for mover
+        int mover = -player;
+        for (uint32_t n : path) {
+            int points = (winner == 0) ? 1 : (winner == mover) ? 2 : 0;
+            if (points) pool_[n].score.fetch_add(points, memory_order_relaxed);
+            mover = -mover;
+        }
+        for (size_t i = played.size(); i-- > 0;) {
+            board.undo(played[i]);
+        }
+        done++;
+    }
+    playouts = done;
+}
+
+template <class Board>
+int Mcts::best_move(const Board& board, int player, const MctsLimits& limits, MctsStats& stats) {
+    int64_t start = now_ns();
+    next_node_.store(1, memory_order_relaxed);
+    init_node(0, -1);
+    iterations_.store(0, memory_order_relaxed);
+    stop_.store(false, memory_order_relaxed);
+    deadline_ = start + (int64_t)limits.milliseconds * 1000000;
+
+    // Take a win on the spot, or block the opponent's, without searching
+    int tactical = tactical_move(board, player);
+    if (tactical >= 0) {
+        stats.playouts = 0;
+        stats.nodes = 0;
+        stats.seconds = (now_ns() - start) / 1e9;
+        return tactical;
+    }
+
+    unsigned threads = limits.threads ? limits.threads : 1;
+    vector<uint64_t> playouts(threads, 0);
+    vector<thread> workers;
+    for (unsigned t = 1; t < threads; t++) {
+        workers.push_back(thread(&Mcts::search<Board>, this, cref(board), player, cref(limits),
+                                 0x5EED0000ULL + t, ref(playouts[t])));
+    }
+    search(board, player, limits, 0x5EED0000ULL, playouts[0]);
+    stop_.store(true, memory_order_relaxed);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    const Node& root = pool_[0];
+    int32_t first = root.first_child.load(memory_order_acquire);
+    int best = -1;
+    int32_t best_visits = -1;
+    for (int32_t c = first; first >= 0 && c < first + root.children; c++) {
+        int32_t visits = pool_[c].visits.load(memory_order_relaxed);
+        if (visits > best_visits) {
+            best_visits = visits;
+            best = pool_[c].move;
+        }
+    }
+    if (best < 0) {
+        // No iteration finished: fall back to the first legal move
+        vector<int> moves(board.size());
+        board.legal_moves(moves.data());
+        best = moves[0];
+    }
+
+    stats.playouts = 0;
+    for (uint64_t p : playouts) stats.playouts += p;
+    stats.nodes = min(next_node_.load(), max_nodes_);
+    stats.seconds = (now_ns() - start) / 1e9;
+    return best;
+}
+
+template int Mcts::best_move<MnkBoard>(const MnkBoard&, int, const MctsLimits&, MctsStats&);
+template int Mcts::best_move<UltimateBoard>(const UltimateBoard&, int, const MctsLimits&, MctsStats&);
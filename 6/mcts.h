@@ -0,0 +1,61 @@
+#ifndef MCTS_H
+#define MCTS_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include "mnk.h"
+#include "ultimate.h"
+
+// Budget of one MCTS move: stops at whichever limit is hit first
+struct MctsLimits {
+    unsigned threads;
+    uint64_t iterations;    // 0 for no limit
+    unsigned milliseconds;  // 0 for no limit
+};
+
+struct MctsStats {
+    uint64_t playouts;
+    uint64_t nodes;
+    double seconds;
+};
+
+// Monte Carlo Tree Search (UCT) with tree parallelism, for MnkBoard and
+// UltimateBoard positions:
+// all threads grow one shared tree held in a preallocated node pool. A
+// thread descending through a node counts a visit straight away (virtual
+// loss) so that the other threads spread out to other lines, and adds the
+// score once its random playout is back. Nodes are expanded by the first
+// thread to claim them and published with release/acquire ordering.
+class Mcts {
+public:
+    explicit Mcts(uint32_t max_nodes = 1 << 21);
+
+    // Function to search the position for player (1 or -1) to move and
+    // return the most visited move
+    template <class Board>
+    int best_move(const Board& board, int player, const MctsLimits& limits, MctsStats& stats);
+
+private:
+    struct Node {
+        std::atomic<int32_t> visits;
+        std::atomic<int32_t> score;        // 2 per win, 1 per draw for the player who moved here
+        std::atomic<int32_t> first_child;  // UNEXPANDED, EXPANDING or a pool index
+        int32_t children;
+        int32_t move;
+    };
+
+    void init_node(uint32_t index, int move);
+    template <class Board>
+    void search(const Board& root, int player, const MctsLimits& limits, uint64_t seed, uint64_t& playouts);
+    uint32_t select_child(const Node& node) const;
+
+    std::unique_ptr<Node[]> pool_;
+    uint32_t max_nodes_;
+    std::atomic<uint32_t> next_node_;
+    std::atomic<uint64_t> iterations_;
+    std::atomic<bool> stop_;
+    int64_t deadline_;   // steady clock, nanoseconds
+};
+
+#endif
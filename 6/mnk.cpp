@@ -0,0 +1,209 @@
+#include "mnk.h"
+#include <algorithm>
+
+using namespace std;
+
+static const int DIRECTIONS[4][2] = {{0, 1}, {1, 0}, {1, 1}, {1, -1}};
+static const Line LINES[4] = {LINE_ROW, LINE_COLUMN, LINE_DIAGONAL, LINE_ANTI_DIAGONAL};
+
+// ---------------------------------------------------------------------------
+// Kernels for the square boards in use. Each is compiled for one size, so
+// strides and loop bounds are constants and the line table is built by the
+// compiler; MnkBoard picks one when it is constructed.
+// ---------------------------------------------------------------------------
+
+struct MnkKernel {
+    int size;   // rows and cols
+    Line (*play)(const int8_t* cells, int cell, int player, int k);
+    int (*legal_moves)(const int8_t* cells, int* moves);
+    int (*first_free)(const int8_t* cells, const int* order, int from);
+    void (*render)(const int8_t* cells, string& frame);
+};
+
+// For every cell of an n x n board, how many cells lie between it and the
+// edge in each direction: right, down, down-right, down-left (DIRECTIONS
+// order), then the four opposites
+template <int N>
+struct LineTable {
+    uint8_t reach[N * N][8];
+
+    constexpr LineTable() : reach() {
+        for (int cell = 0; cell < N * N; cell++) {
+            int row = cell / N, col = cell % N;
+            int right = N - 1 - col, down = N - 1 - row;
+            reach[cell][0] = right;
+            reach[cell][1] = down;
+            reach[cell][2] = min(down, right);
+            reach[cell][3] = min(down, col);
+            reach[cell][4] = col;
+            reach[cell][5] = row;
+            reach[cell][6] = min(row, col);
+            reach[cell][7] = min(row, right);
+        }
+    }
+};
+
+template <int N>
+constexpr LineTable<N> LINE_TABLE = LineTable<N>();
+
+// Digits in the largest cell number, the width of a rendered cell
+constexpr int cell_width(int cells) {
+    return cells < 10 ? 1 : 1 + cell_width(cells / 10);
+}
+
+template <int N>
+static Line play_kernel(const int8_t* cells, int cell, int player, int k) {
+    const int steps[4] = {1, N, N + 1, N - 1};
+    const uint8_t* reach = LINE_TABLE<N>.reach[cell];
+    for (int d = 0; d < 4; d++) {
+        int step = steps[d];
+        int forward = min<int>(reach[d], k - 1);
+        int backward = min<int>(reach[d + 4], k - 1);
+        int count = 1;
+        for (int i = 1; i <= forward && cells[cell + i * step] == player; i++) count++;
+        for (int i = 1; i <= backward && cells[cell - i * step] == player; i++) count++;
+        if (count >= k) return LINES[d];
+    }
+    return LINE_NONE;
+}
+
+template <int N>
+static int legal_moves_kernel(const int8_t* cells, int* moves) {
+    int count = 0;
+    for (int cell = 0; cell < N * N; cell++) {
+        moves[count] = cell;
+        count += (cells[cell] == 0);
+    }
+    return count;
+}
+
+template <int N>
+static int first_free_kernel(const int8_t* cells, const int* order, int from) {
+    while (from < N * N - 1 && cells[order[from]] != 0) from++;
+    return from;
+}
+
+// Renders exactly as MnkBoard::render does, into one allocation
+template <int N>
+static void render_kernel(const int8_t* cells, string& frame) {
+    const int width = cell_width(N * N);
+    const int separator = N * (width + 3) + 2;
+    const int row_length = (separator + 1) + 2 + N * (width + 3) + 1;
+    frame.assign(N * row_length + separator + 1, ' ');
+    char* out = &frame[0];
+    for (int row = 0; row <= N; row++) {
+        for (int i = 0; i < separator; i++) *out++ = '-';
+        *out++ = '\n';
+        if (row == N) break;
+        *out++ = '|';
+        *out++ = ' ';
+        for (int col = 0; col < N; col++) {
+            int cell = row * N + col;
+            if (cells[cell] != 0) {
+                *out = (cells[cell] == 1) ? 'X' : 'O';
+            } else {
+                char digits[4];
+                int length = 0;
+                for (int number = cell + 1; number; number /= 10) digits[length++] = '0' + number % 10;
+                for (int i = 0; i < length; i++) out[i] = digits[length - 1 - i];
+            }
+            out += width + 1;   // padding is already spaces
+            *out++ = '|';
+            *out++ = ' ';
+        }
+        *out++ = '\n';
+    }
+}
+
+template <int N>
+static const MnkKernel KERNEL = {N, play_kernel<N>, legal_moves_kernel<N>, first_free_kernel<N>, render_kernel<N>};
+
+static const MnkKernel* const KERNELS[] = {&KERNEL<3>, &KERNEL<4>, &KERNEL<5>, &KERNEL<7>, &KERNEL<15>};
+
+// Function to find the kernel compiled for a board shape, if any
+static const MnkKernel* find_kernel(int rows, int cols) {
+    for (const MnkKernel* kernel : KERNELS) {
+        if (rows == kernel->size && cols == kernel->size) return kernel;
+    }
+    return nullptr;
+}
+
+// ---------------------------------------------------------------------------
+// Board
+// ---------------------------------------------------------------------------
+
+MnkBoard::MnkBoard(int rows, int cols, int k)
+    : rows_(rows), cols_(cols), k_(k), moves_(0), cells_(rows * cols, 0), kernel_(find_kernel(rows, cols)) {
+}
+
+// Function to count the player's stones from (row, col) onwards in one direction
+int MnkBoard::run(int row, int col, int drow, int dcol, int player) const {
+    int count = 0;
+    row += drow;
+    col += dcol;
+    while (row >= 0 && row < rows_ && col >= 0 && col < cols_ && count < k_ &&
+           cells_[row * cols_ + col] == player) {
+        count++;
+        row += drow;
+        col += dcol;
+    }
+    return count;
+}
+
+int MnkBoard::legal_moves(int* moves) const {
+    if (kernel_) return kernel_->legal_moves(cells_.data(), moves);
+    int count = 0;
+    for (int cell = 0; cell < size(); cell++) {
+        if (cells_[cell] == 0) moves[count++] = cell;
+    }
+    return count;
+}
+
+int MnkBoard::first_free(const int* order, int from) const {
+    if (kernel_) return kernel_->first_free(cells_.data(), order, from);
+    while (from < size() - 1 && cells_[order[from]] != 0) from++;
+    return from;
+}
+
+Line MnkBoard::play(int cell, int player) {
+    cells_[cell] = player;
+    moves_++;
+    if (kernel_) return kernel_->play(cells_.data(), cell, player, k_);
+
+    int row = cell / cols_;
+    int col = cell % cols_;
+    for (int d = 0; d < 4; d++) {
+        int drow = DIRECTIONS[d][0];
+        int dcol = DIRECTIONS[d][1];
+        if (1 + run(row, col, drow, dcol, player) + run(row, col, -drow, -dcol, player) >= k_) {
+            return LINES[d];
+        }
+    }
+    return LINE_NONE;
+}
+
+void MnkBoard::undo(int cell) {
+    cells_[cell] = 0;
+    moves_--;
+}
+
+string MnkBoard::render() const {
+    string frame;
+    if (kernel_) {
+        kernel_->render(cells_.data(), frame);
+        return frame;
+    }
+    int width = to_string(size()).length();
+    string separator(cols_ * (width + 3) + 2, '-');
+    for (int row = 0; row < rows_; row++) {
+        frame += separator + "\n| ";
+        for (int col = 0; col < cols_; col++) {
+            int cell = row * cols_ + col;
+            string mark = (cells_[cell] == 1) ? "X" : (cells_[cell] == -1) ? "O" : to_string(cell + 1);
+            frame += mark + string(width - mark.length(), ' ') + " | ";
+        }
+        frame += "\n";
+    }
+    frame += separator + "\n";
+    return frame;
+}
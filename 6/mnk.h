@@ -0,0 +1,61 @@
+#ifndef MNK_H
+#define MNK_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Direction of a completed line, in the order check_board reports them
+enum Line { LINE_NONE, LINE_ROW, LINE_COLUMN, LINE_DIAGONAL, LINE_ANTI_DIAGONAL };
+
+struct MnkKernel;
+
+// Board of rows x cols cells where k stones in a row win (m,n,k-game).
+// Cells are numbered 0 .. rows*cols-1 row by row; each holds 1 for the AI
+// (X), -1 for the human (O) or 0 when empty. Only the lines through the
+// last stone are examined, so a move costs O(k) whatever the board size.
+// Square boards of the sizes in use (3, 4, 5, 7 and 15) run on kernels
+// compiled for their size; any other shape runs the generic loops.
+class MnkBoard {
+public:
+    MnkBoard(int rows, int cols, int k);
+
+    int rows() const { return rows_; }
+    int cols() const { return cols_; }
+    int k() const { return k_; }
+    int size() const { return rows_ * cols_; }
+    int moves() const { return moves_; }
+    bool full() const { return moves_ == size(); }
+
+    int at(int cell) const { return cells_[cell]; }
+    bool is_free(int cell) const { return cells_[cell] == 0; }
+
+    // Function to list the free cells; returns how many
+    int legal_moves(int* moves) const;
+
+    // Function to find the first free cell of a cell order, starting at
+    // position from; the order must still have a free cell there or later
+    int first_free(const int* order, int from) const;
+
+    // Places a stone for player (1 or -1) on a free cell and returns the
+    // line it completed, if any
+    Line play(int cell, int player);
+
+    // Removes the stone on a cell (for search)
+    void undo(int cell);
+
+    // Function to render the board with free cells numbered from 1
+    std::string render() const;
+
+private:
+    int run(int row, int col, int drow, int dcol, int player) const;
+
+    int rows_;
+    int cols_;
+    int k_;
+    int moves_;
+    std::vector<int8_t> cells_;
+    const MnkKernel* kernel_;   // nullptr for the generic loops
+};
+
+#endif
@@ -0,0 +1,62 @@
+#include "policy.h"
+#include "board.h"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+
+Policy::Policy() : map_(nullptr), length_(0), moves_(nullptr) {
+}
+
+Policy::~Policy() {
+    if (map_) {
+        munmap((void*)map_, length_);
+    }
+}
+
+bool Policy::open(const string& path, string& error) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        error = "Cannot open " + path + ": " + strerror(errno);
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) < 0 || (size_t)st.st_size != sizeof(PolicyHeader) + POSITIONS) {
+        error = "Not a policy: " + path;
+        close(fd);
+        return false;
+    }
+    void* map = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        error = "Cannot map " + path + ": " + strerror(errno);
+        return false;
+    }
+
+    PolicyHeader header;
+    memcpy(&header, map, sizeof(header));
+    if (memcmp(header.magic, "TTTP", 4) != 0 || header.version != POLICY_VERSION ||
+        header.positions != (uint32_t)POSITIONS) {
+        error = "Not a policy: " + path;
+        munmap(map, st.st_size);
+        return false;
+    }
+
+    if (map_) {
+        munmap((void*)map_, length_);
+    }
+    map_ = (const uint8_t*)map;
+    length_ = st.st_size;
+    moves_ = map_ + sizeof(header);
+    return true;
+}
+
+int Policy::move(uint16_t x, uint16_t o) const {
+    uint8_t cell = moves_[POSITION_BASE3[x] + 2 * POSITION_BASE3[o]];
+    if (cell >= 9 || ((x | o) & (1 << cell))) return -1;
+    return cell;
+}
@@ -0,0 +1,43 @@
+#ifndef POLICY_H
+#define POLICY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Learned move policy for the classic board, written by ttttrain: a header,
+// then one byte per position, indexed like the solved table (board.h).
+// Each byte is the cell X plays there, or POLICY_NONE where training never
+// got to choose.
+const uint32_t POLICY_VERSION = 1;
+const uint8_t POLICY_NONE = 0xFF;
+
+struct PolicyHeader {
+    char magic[4];              // "TTTP"
+    uint32_t version;
+    uint32_t positions;         // POSITIONS
+    uint32_t reserved;
+};
+
+// Read-only view of a policy file, mapped like a tablebase
+class Policy {
+public:
+    Policy();
+    ~Policy();
+    Policy(const Policy&) = delete;
+    Policy& operator=(const Policy&) = delete;
+
+    // Function to map a policy file; on failure returns false and sets
+    // error to the message the CLI prints
+    bool open(const std::string& path, std::string& error);
+
+    // Function to look up the policy's move for X, or -1 if it has none
+    int move(uint16_t x, uint16_t o) const;
+
+private:
+    const uint8_t* map_;
+    size_t length_;
+    const uint8_t* moves_;
+};
+
+#endif
@@ -0,0 +1,25 @@
+#include "protocol.h"
+
+using namespace std;
+
+void append_move(string& out, ProtocolMode mode, int player, int cell, Result result) {
+    if (mode == PROTOCOL_BINARY) {
+        MoveRecord record;
+        record.player = (player == 1) ? 1 : (player == -1) ? 2 : 0;
+        record.result = (player == 0) ? RESULT_ILLEGAL_MOVE : result;
+        record.cell = (player == 0) ? 0 : cell + 1;
+        out.append(reinterpret_cast<const char*>(&record), sizeof(record));
+        return;
+    }
+    if (player == 0) {
+        out += "E\n";
+        return;
+    }
+    static const char states[] = "-WLD";
+    out += (player == 1) ? 'X' : 'O';
+    out += ' ';
+    out += to_string(cell + 1);
+    out += ' ';
+    out += states[result];
+    out += '\n';
+}
@@ -0,0 +1,25 @@
+#ifndef PROTOCOL_H
+#define PROTOCOL_H
+
+#include <cstdint>
+#include <string>
+#include "game.h"
+
+// Compact machine protocol (ttt --protocol): one record per move instead of
+// the human-readable frames. Text records are lines "<X|O> <cell> <state>",
+// with the cell numbered from 1 and the state one of - (ongoing), W (AI
+// wins), L (AI loses) or D (draw). A rejected human input is the line "E".
+enum ProtocolMode { PROTOCOL_NONE, PROTOCOL_TEXT, PROTOCOL_BINARY };
+
+// Fixed-size binary record (--protocol=binary), in host byte order
+struct MoveRecord {
+    uint8_t player;   // 1 = AI (X), 2 = human (O), 0 = rejected input
+    uint8_t result;   // Result after the move
+    uint16_t cell;    // cell numbered from 1, 0 for rejected input
+};
+
+// Function to append the record of a move; player is 1 for the AI, -1 for
+// the human and 0 for a rejected input
+void append_move(std::string& out, ProtocolMode mode, int player, int cell, Result result);
+
+#endif
@@ -0,0 +1,271 @@
+#include "qubic.h"
+#include <chrono>
+
+using namespace std;
+
+const int SCORE_WIN = 1000000;
+const int SCORE_INF = SCORE_WIN + 1;
+const int SCORE_DECIDED = SCORE_WIN - 1000;
+const int MAX_PLY = 64;
+
+// Value of a line open to one side, by the stones it holds
+const int LINE_VALUE[4] = {0, 1, 8, 64};
+
+enum Bound : uint8_t { BOUND_EXACT, BOUND_LOWER, BOUND_UPPER };
+
+static int64_t now_ns() {
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+constexpr QubicLines::QubicLines() : mask(), through(), count() {
+    int lines = 0;
+    // The 13 directions with a positive first non-zero step, from every
+    // cell where a line of four fits and does not extend backwards
+    for (int dl = -1; dl <= 1; dl++) {
+        for (int dr = -1; dr <= 1; dr++) {
+            for (int dc = -1; dc <= 1; dc++) {
+                if (dl < 0 || (dl == 0 && (dr < 0 || (dr == 0 && dc <= 0)))) continue;
+                for (int cell = 0; cell < QUBIC_CELLS; cell++) {
+                    int l = cell / 16, r = cell / 4 % 4, c = cell % 4;
+                    bool fits = l + 3 * dl >= 0 && l + 3 * dl < 4 && r + 3 * dr >= 0 && r + 3 * dr < 4 &&
+                                c + 3 * dc >= 0 && c + 3 * dc < 4;
+                    bool extends = l - dl >= 0 && l - dl < 4 && r - dr >= 0 && r - dr < 4 && c - dc >= 0 &&
+                                   c - dc < 4;
+                    if (!fits || extends) continue;
+                    mask[lines] = 0;
+                    for (int i = 0; i < 4; i++) {
+                        int on = (l + i * dl) * 16 + (r + i * dr) * 4 + c + i * dc;
+                        mask[lines] |= 1ULL << on;
+                        through[on][count[on]++] = lines;
+                    }
+                    lines++;
+                }
+            }
+        }
+    }
+}
+
+const QubicLines QUBIC;
+
+bool QubicBoard::play(int cell, int player) {
+    uint64_t& mine = (player == 1) ? x_ : o_;
+    mine |= 1ULL << cell;
+    moves_++;
+    for (int i = 0; i < QUBIC.count[cell]; i++) {
+        uint64_t line = QUBIC.mask[QUBIC.through[cell][i]];
+        if ((mine & line) == line) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void QubicBoard::undo(int cell) {
+    x_ &= ~(1ULL << cell);
+    o_ &= ~(1ULL << cell);
+    moves_--;
+}
+
+int QubicBoard::evaluate(int player) const {
+    uint64_t mine = stones(player), theirs = stones(-player);
+    int score = 0;
+    for (int i = 0; i < QUBIC_LINES; i++) {
+        int a = __builtin_popcountll(mine & QUBIC.mask[i]);
+        int t = __builtin_popcountll(theirs & QUBIC.mask[i]);
+        if (t == 0) {
+            score += LINE_VALUE[a];
+        } else if (a == 0) {
+            score -= LINE_VALUE[t];
+        }
+    }
+    return score;
+}
+
+string QubicBoard::render() const {
+    string out = "  layer 1    layer 2    layer 3    layer 4\n";
+    for (int row = 0; row < 4; row++) {
+        out += to_string(row + 1) + " ";
+        for (int layer = 0; layer < 4; layer++) {
+            for (int col = 0; col < 4; col++) {
+                int stone = at(layer * 16 + row * 4 + col);
+                out += stone == 1 ? 'X' : stone == -1 ? 'O' : '.';
+                out += ' ';
+            }
+            out += (layer == 3) ? "\n" : "   ";
+        }
+    }
+    return out;
+}
+
+QubicSearch::QubicSearch(int table_bits)
+    : table_(1ULL << table_bits), mask_((1ULL << table_bits) - 1), nodes_(0), deadline_(0), stop_(false),
+      root_move_(-1) {
+}
+
+// Function to hash a position (the side to move follows from the stones)
+static uint64_t position_key(uint64_t x, uint64_t o) {
+    uint64_t z = x * 0x9E3779B97F4A7C15ULL ^ (o + 0x632BE59BD9B4E019ULL) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return (z ^ (z >> 31)) | 1;     // never 0, the key of an empty slot
+}
+
+// Negamax score for player to move, fail-soft
+int QubicSearch::search(QubicBoard& board, int player, int depth, int ply, int alpha, int beta) {
+    nodes_++;
+    if ((nodes_ & 1023) == 0 && deadline_ && now_ns() >= deadline_) {
+        stop_ = true;
+    }
+    if (stop_) {
+        return 0;
+    }
+
+    // Threats: our three in a line wins now, the opponent's must be blocked
+    uint64_t mine = board.stones(player), theirs = board.stones(-player);
+    uint64_t taken = mine | theirs;
+    uint64_t wins = 0, blocks = 0;
+    for (int i = 0; i < QUBIC_LINES; i++) {
+        uint64_t line = QUBIC.mask[i];
+        int a = __builtin_popcountll(mine & line);
+        int t = __builtin_popcountll(theirs & line);
+        if (a == 3 && t == 0) {
+            wins |= line & ~taken;
+        } else if (t == 3 && a == 0) {
+            blocks |= line & ~taken;
+        }
+    }
+    if (wins) {
+        if (ply == 0) root_move_ = __builtin_ctzll(wins);
+        return SCORE_WIN - ply;
+    }
+    if (__builtin_popcountll(blocks) >= 2) {
+        if (ply == 0) root_move_ = __builtin_ctzll(blocks);
+        return -(SCORE_WIN - ply - 1);
+    }
+    if (board.full()) {
+        return 0;
+    }
+    if (depth <= 0 || ply >= MAX_PLY - 1) {
+        return board.evaluate(player);
+    }
+
+    uint64_t key = position_key(board.stones(1), board.stones(-1));
+    TTEntry& entry = table_[key & mask_];
+    int tt_move = -1;
+    if (entry.key == key) {
+        tt_move = entry.move;
+        int score = entry.score;
+        if (score > SCORE_DECIDED) score -= ply;
+        if (score < -SCORE_DECIDED) score += ply;
+        if (ply > 0 && entry.depth >= depth &&
+            (entry.bound == BOUND_EXACT || (entry.bound == BOUND_LOWER && score >= beta) ||
+             (entry.bound == BOUND_UPPER && score <= alpha))) {
+            return score;
+        }
+    }
+
+    // A forced block is the only move and costs no depth
+    int moves[QUBIC_CELLS];
+    int order[QUBIC_CELLS];
+    int count = 0;
+    if (blocks) {
+        moves[count] = __builtin_ctzll(blocks);
+        order[count++] = 0;
+        depth++;
+    } else {
+        for (uint64_t free_cells = ~taken; free_cells; free_cells &= free_cells - 1) {
+            int cell = __builtin_ctzll(free_cells);
+            int value = 0;
+            for (int i = 0; i < QUBIC.count[cell]; i++) {
+                uint64_t line = QUBIC.mask[QUBIC.through[cell][i]];
+                int a = __builtin_popcountll(mine & line);
+                int t = __builtin_popcountll(theirs & line);
+                if (t == 0) value += 2 * LINE_VALUE[a] + 1;
+                if (a == 0) value += LINE_VALUE[t];
+            }
+            if (cell == tt_move) value = 1 << 30;
+            // Insertion sort, best first
+            int i = count++;
+            while (i > 0 && order[i - 1] < value) {
+                moves[i] = moves[i - 1];
+                order[i] = order[i - 1];
+                i--;
+            }
+            moves[i] = cell;
+            order[i] = value;
+        }
+    }
+
+    int best_score = -SCORE_INF;
+    int best_move = -1;
+    int bound = BOUND_UPPER;
+    for (int i = 0; i < count; i++) {
+        board.play(moves[i], player);
+        int score = -search(board, -player, depth - 1, ply + 1, -beta, -alpha);
+        board.undo(moves[i]);
+        if (stop_) {
+            return 0;
+        }
+        if (score > best_score) {
+            best_score = score;
+            best_move = moves[i];
+            if (ply == 0) root_move_ = best_move;
+        }
+        if (score > alpha) {
+            alpha = score;
+            bound = BOUND_EXACT;
+        }
+        if (alpha >= beta) {
+            bound = BOUND_LOWER;
+            break;
+        }
+    }
+
+    int stored = best_score;
+    if (stored > SCORE_DECIDED) stored += ply;
+    if (stored < -SCORE_DECIDED) stored -= ply;
+    entry.key = key;
+    entry.score = stored;
+    entry.depth = depth;
+    entry.bound = bound;
+    entry.move = best_move;
+    return best_score;
+}
+
+int QubicSearch::best_move(const QubicBoard& board, int player, const QubicLimits& limits, QubicStats& stats) {
+    int64_t start = now_ns();
+    deadline_ = limits.milliseconds ? start + (int64_t)limits.milliseconds * 1000000 : 0;
+    stop_ = false;
+    nodes_ = 0;
+    root_move_ = -1;
+
+    QubicBoard work = board;
+    int max_depth = QUBIC_CELLS - board.moves();
+    if (limits.depth) {
+        max_depth = min(max_depth, limits.depth);
+    }
+    int best = -1;
+    stats.depth = 0;
+    stats.score = 0;
+    for (int depth = 1; depth <= max_depth; depth++) {
+        int score = search(work, player, depth, 0, -SCORE_INF, SCORE_INF);
+        if (stop_) {
+            break;
+        }
+        best = root_move_;
+        stats.depth = depth;
+        stats.score = score;
+        if (score > SCORE_DECIDED || score < -SCORE_DECIDED) {
+            break;
+        }
+    }
+    if (best < 0) {
+        best = root_move_;
+    }
+    for (int cell = 0; best < 0 && cell < QUBIC_CELLS; cell++) {
+        if (board.is_free(cell)) best = cell;
+    }
+    stats.nodes = nodes_;
+    stats.seconds = (now_ns() - start) / 1e9;
+    return best;
+}
@@ -0,0 +1,102 @@
+#ifndef QUBIC_H
+#define QUBIC_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// 4x4x4 tic-tac-toe (Qubic). Cell n = layer * 16 + row * 4 + col, and bit n
+// of a player's mask is set when that player owns cell n, as the 3x3 masks
+// in board.h. Any of the 76 lines of four wins: rows, columns and pillars,
+// the diagonals of every plane, and the 4 space diagonals.
+const int QUBIC_CELLS = 64;
+const int QUBIC_LINES = 76;
+
+// The line masks, and for every cell the lines through it (4 or 7)
+struct QubicLines {
+    uint64_t mask[QUBIC_LINES];
+    uint8_t through[QUBIC_CELLS][7];
+    uint8_t count[QUBIC_CELLS];
+
+    // Built by the compiler, so no program pays for it at startup
+    constexpr QubicLines();
+};
+
+extern const QubicLines QUBIC;
+
+// Players are 1 (X, moves first) and -1 (O)
+class QubicBoard {
+public:
+    QubicBoard() : x_(0), o_(0), moves_(0) {}
+
+    uint64_t stones(int player) const { return player == 1 ? x_ : o_; }
+    int moves() const { return moves_; }
+    bool full() const { return moves_ == QUBIC_CELLS; }
+    bool is_free(int cell) const { return !((x_ | o_) >> cell & 1); }
+    int at(int cell) const { return (x_ >> cell & 1) ? 1 : (o_ >> cell & 1) ? -1 : 0; }
+
+    // Places a stone for player on a free cell; returns true when it
+    // completes a line. Only the lines through the cell are checked.
+    bool play(int cell, int player);
+
+    // Removes the stone on a cell (for search)
+    void undo(int cell);
+
+    // Function to score the position for player: every line still open to
+    // one side counts for that side, more the more stones it holds
+    int evaluate(int player) const;
+
+    // Function to render the 4 layers side by side
+    std::string render() const;
+
+private:
+    uint64_t x_;
+    uint64_t o_;
+    int moves_;
+};
+
+// Budget of one move: stops at whichever limit is hit first
+struct QubicLimits {
+    int depth;              // 0 for no limit
+    unsigned milliseconds;  // 0 for no limit
+};
+
+struct QubicStats {
+    uint64_t nodes;
+    int depth;              // deepest iteration completed
+    int score;              // for the side to move
+    double seconds;
+};
+
+// Iterative-deepening alpha-beta over the bitboards. Threats are read off
+// the line popcounts: a line with three of our stones and a free cell wins
+// on the spot, and one of the opponent's must be blocked, which leaves a
+// single move to search (or none, against two such lines). Other moves are
+// ordered by the table move, then by the open lines through each cell.
+class QubicSearch {
+public:
+    explicit QubicSearch(int table_bits = 20);
+
+    // Function to search the position for player to move
+    int best_move(const QubicBoard& board, int player, const QubicLimits& limits, QubicStats& stats);
+
+private:
+    struct TTEntry {
+        uint64_t key;
+        int32_t score;
+        int16_t depth;
+        uint8_t bound;
+        int8_t move;
+    };
+
+    int search(QubicBoard& board, int player, int depth, int ply, int alpha, int beta);
+
+    std::vector<TTEntry> table_;
+    uint64_t mask_;
+    uint64_t nodes_;
+    int64_t deadline_;      // steady clock, nanoseconds
+    bool stop_;
+    int root_move_;
+};
+
+#endif
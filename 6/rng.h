@@ -0,0 +1,24 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <cstdint>
+
+// Per-thread deterministic generator (splitmix64)
+struct Rng {
+    uint64_t state;
+    uint64_t next() {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+};
+
+// Function to pick a uniformly random set bit of a non-empty mask
+inline int random_cell(uint16_t mask, Rng& rng) {
+    int k = rng.next() % __builtin_popcount(mask);
+    while (k--) mask &= mask - 1;
+    return __builtin_ctz(mask);
+}
+
+#endif
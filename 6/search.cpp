@@ -0,0 +1,481 @@
+#include "search.h"
+#include "rng.h"
+#include <chrono>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+
+const int SCORE_WIN = 1 << 30;
+const int SCORE_INF = SCORE_WIN + 1;
+const int SCORE_DECIDED = SCORE_WIN - 100000;   // beyond this a win or loss is proven
+const int MAX_PLY = 128;
+const int NEAR = 2;                              // candidate moves lie this close to a stone
+const int HISTORY_MAX = 1 << 20;
+
+enum Bound : uint8_t { BOUND_EXACT, BOUND_LOWER, BOUND_UPPER };
+
+// Start of a shared table segment; the slots follow on the next cache line
+struct SharedHeader {
+    std::atomic<uint64_t> magic;      // set last, once the segment is sized
+    uint64_t bits;
+};
+const uint64_t SHARED_MAGIC = 0x5454545353544231ULL;
+const size_t SHARED_OFFSET = 64;
+
+static int64_t now_ns() {
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// State of one search thread: its own board, hash and evaluation, kept up
+// to date move by move, and its move ordering tables
+struct LazySmp::Worker {
+    int id;
+    MnkBoard board;
+    int player;                 // side to move
+    uint64_t hash;
+    int eval;                   // window score, positive when X is ahead
+    const uint64_t* zobrist;
+    const int* weights;
+    vector<int> near;           // stones within NEAR of each cell
+    vector<int> moves;          // move lists of all plies, back to back
+    vector<int> order;          // their ordering scores
+    vector<int> history;        // [cell * 2 + side]
+    int killers[MAX_PLY][2];
+    uint64_t nodes;
+    int root_move;              // best root move of the iteration in progress
+    int best;                   // ... and of the last completed iteration
+    int score;
+    int depth;
+
+    Worker(int rows, int cols, int k) : board(rows, cols, k) {}
+
+    // Function to score the k-windows through a cell
+    int windows(int cell) const;
+
+    Line play(int cell);
+    void undo(int cell);
+    void touch(int cell, int delta);
+};
+
+int LazySmp::Worker::windows(int cell) const {
+    static const int directions[4][2] = {{0, 1}, {1, 0}, {1, 1}, {1, -1}};
+    int rows = board.rows(), cols = board.cols(), k = board.k();
+    int row = cell / cols, col = cell % cols;
+    int total = 0;
+    for (int d = 0; d < 4; d++) {
+        int drow = directions[d][0], dcol = directions[d][1];
+        int back = 0, ahead = 0;
+        while (back < k - 1 && row - (back + 1) * drow >= 0 && col - (back + 1) * dcol >= 0 &&
+               col - (back + 1) * dcol < cols) {
+            back++;
+        }
+        while (ahead < k - 1 && row + (ahead + 1) * drow < rows && col + (ahead + 1) * dcol < cols &&
+               col + (ahead + 1) * dcol >= 0) {
+            ahead++;
+        }
+        // Slide a window of k cells along the segment through the cell
+        int start = (row - back * drow) * cols + col - back * dcol;
+        int step = drow * cols + dcol;
+        int x = 0, o = 0;
+        for (int i = 0; i <= back + ahead; i++) {
+            int stone = board.at(start + i * step);
+            x += stone == 1;
+            o += stone == -1;
+            if (i >= k) {
+                int gone = board.at(start + (i - k) * step);
+                x -= gone == 1;
+                o -= gone == -1;
+            }
+            if (i >= k - 1) {
+                if (o == 0) {
+                    total += weights[x];
+                } else if (x == 0) {
+                    total -= weights[o];
+                }
+            }
+        }
+    }
+    return total;
+}
+
+// Function to add delta to the neighbour count of the cells around a stone
+void LazySmp::Worker::touch(int cell, int delta) {
+    int rows = board.rows(), cols = board.cols();
+    int row = cell / cols, col = cell % cols;
+    for (int r = max(0, row - NEAR); r <= min(rows - 1, row + NEAR); r++) {
+        for (int c = max(0, col - NEAR); c <= min(cols - 1, col + NEAR); c++) {
+            near[r * cols + c] += delta;
+        }
+    }
+}
+
+Line LazySmp::Worker::play(int cell) {
+    eval -= windows(cell);
+    Line line = board.play(cell, player);
+    eval += windows(cell);
+    hash ^= zobrist[cell * 2 + (player == 1 ? 0 : 1)] ^ zobrist[board.size() * 2];
+    touch(cell, 1);
+    player = -player;
+    return line;
+}
+
+void LazySmp::Worker::undo(int cell) {
+    player = -player;
+    touch(cell, -1);
+    hash ^= zobrist[cell * 2 + (player == 1 ? 0 : 1)] ^ zobrist[board.size() * 2];
+    eval -= windows(cell);
+    board.undo(cell);
+    eval += windows(cell);
+}
+
+LazySmp::LazySmp(int table_bits)
+    : table_(nullptr), mask_((1ULL << table_bits) - 1), shared_(nullptr), shared_length_(0), rows_(0), cols_(0),
+      k_(0), stop_(false), deadline_(0) {
+}
+
+LazySmp::~LazySmp() {
+    if (shared_) {
+        munmap(shared_, shared_length_);
+    }
+}
+
+bool LazySmp::attach(const string& name, string& error) {
+    string path = (name[0] == '/') ? name : "/" + name;
+    uint64_t bits = __builtin_ctzll(mask_ + 1);
+    size_t length = SHARED_OFFSET + (mask_ + 1) * sizeof(Slot);
+
+    // The segment is set up under an exclusive lock, so an attacher sees it
+    // either complete or not started. One left without its magic by a
+    // process that died setting it up is simply set up again.
+    int fd = shm_open(path.c_str(), O_RDWR | O_CREAT, 0666);
+    if (fd < 0) {
+        error = "Cannot open shared table " + path + ": " + strerror(errno);
+        return false;
+    }
+    if (flock(fd, LOCK_EX) < 0) {
+        error = "Cannot lock shared table " + path + ": " + strerror(errno);
+        close(fd);
+        return false;
+    }
+    void* map = MAP_FAILED;
+    struct stat st;
+    if (fstat(fd, &st) == 0 && (size_t)st.st_size >= SHARED_OFFSET) {
+        map = mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (map != MAP_FAILED && ((SharedHeader*)map)->magic.load(memory_order_acquire) != SHARED_MAGIC) {
+            munmap(map, st.st_size);
+            map = MAP_FAILED;
+        } else if (map != MAP_FAILED) {
+            length = st.st_size;
+        }
+    }
+    if (map == MAP_FAILED) {
+        // Emptying it first zeroes any slots written before a crash
+        if (ftruncate(fd, 0) < 0 || ftruncate(fd, length) < 0) {
+            error = "Cannot size shared table " + path + ": " + strerror(errno);
+            close(fd);
+            return false;
+        }
+        map = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (map != MAP_FAILED) {
+            ((SharedHeader*)map)->bits = bits;
+            ((SharedHeader*)map)->magic.store(SHARED_MAGIC, memory_order_release);
+        }
+    }
+    close(fd);      // drops the lock
+    if (map == MAP_FAILED) {
+        error = "Cannot map shared table " + path + ": " + strerror(errno);
+        return false;
+    }
+    SharedHeader* header = (SharedHeader*)map;
+    if (length != SHARED_OFFSET + (1ULL << header->bits) * sizeof(Slot)) {
+        error = "Shared table " + path + " has an unexpected layout";
+        munmap(map, length);
+        return false;
+    }
+    bits = header->bits;
+
+    if (shared_) {
+        munmap(shared_, shared_length_);
+    }
+    own_.reset();
+    shared_ = map;
+    shared_length_ = length;
+    table_ = (Slot*)((char*)map + SHARED_OFFSET);
+    mask_ = (1ULL << bits) - 1;
+    return true;
+}
+
+void LazySmp::clear() {
+    if (!table_) {
+        return;     // not allocated yet, so still empty
+    }
+    for (uint64_t i = 0; i <= mask_; i++) {
+        table_[i].check.store(0, memory_order_relaxed);
+        table_[i].data.store(0, memory_order_relaxed);
+    }
+}
+
+// Function to set up the keys and window weights for the board's shape.
+// The keys depend only on the shape, so they agree between processes
+// sharing a table, and different shapes do not collide in it.
+void LazySmp::prepare(const MnkBoard& board) {
+    if (board.rows() == rows_ && board.cols() == cols_ && board.k() == k_) {
+        return;
+    }
+    rows_ = board.rows();
+    cols_ = board.cols();
+    k_ = board.k();
+    Rng rng = {0x9E3779B97F4A7C15ULL ^ ((uint64_t)rows_ << 40 | (uint64_t)cols_ << 20 | (uint64_t)k_)};
+    zobrist_.resize(board.size() * 2 + 1);   // the last key flips the side to move
+    for (uint64_t& key : zobrist_) {
+        key = rng.next();
+    }
+    // A window with only one side's stones is worth 8x more per stone, up
+    // to the last five stones before k
+    weights_.assign(k_ + 1, 0);
+    for (int c = 1; c <= k_; c++) {
+        weights_[c] = 1 << (3 * max(0, 4 - (k_ - c)));
+    }
+}
+
+bool LazySmp::probe(uint64_t key, int ply, int& move, int& depth, int& score, int& bound) const {
+    const Slot& slot = table_[key & mask_];
+    uint64_t data = slot.data.load(memory_order_relaxed);
+    if ((slot.check.load(memory_order_relaxed) ^ data) != key) {
+        return false;
+    }
+    move = (int)(data & 0xFFFF) - 1;
+    depth = (data >> 16) & 0xFF;
+    bound = (data >> 24) & 0x3;
+    score = (int32_t)(data >> 32);
+    // Wins are stored as distance from this node, not from the root
+    if (score > SCORE_DECIDED) score -= ply;
+    if (score < -SCORE_DECIDED) score += ply;
+    return true;
+}
+
+void LazySmp::store(uint64_t key, int ply, int move, int depth, int score, int bound) {
+    Slot& slot = table_[key & mask_];
+    uint64_t old = slot.data.load(memory_order_relaxed);
+    if ((slot.check.load(memory_order_relaxed) ^ old) == key && (int)((old >> 16) & 0xFF) > depth) {
+        return;
+    }
+    if (score > SCORE_DECIDED) score += ply;
+    if (score < -SCORE_DECIDED) score -= ply;
+    uint64_t data = (uint64_t)(uint32_t)score << 32 | (uint64_t)bound << 24 | (uint64_t)depth << 16 |
+                    (uint64_t)(move + 1);
+    slot.data.store(data, memory_order_relaxed);
+    slot.check.store(key ^ data, memory_order_relaxed);
+}
+
+// Negamax score for the side to move, fail-soft
+int LazySmp::search(Worker& w, int depth, int ply, int alpha, int beta) {
+    w.nodes++;
+    if (w.id == 0 && (w.nodes & 1023) == 0 && deadline_ && now_ns() >= deadline_) {
+        stop_.store(true, memory_order_relaxed);
+    }
+    if (stop_.load(memory_order_relaxed)) {
+        return 0;
+    }
+    if (depth <= 0 || ply >= MAX_PLY - 1) {
+        return w.player * w.eval;
+    }
+
+    int tt_move = -1, tt_depth = 0, tt_score = 0, tt_bound = 0;
+    if (probe(w.hash, ply, tt_move, tt_depth, tt_score, tt_bound) && ply > 0 && tt_depth >= depth) {
+        if (tt_bound == BOUND_EXACT || (tt_bound == BOUND_LOWER && tt_score >= beta) ||
+            (tt_bound == BOUND_UPPER && tt_score <= alpha)) {
+            return tt_score;
+        }
+    }
+
+    // Candidates: free cells near a stone, the centre on an empty board,
+    // or every free cell if none is near
+    size_t base = w.moves.size();
+    int size = w.board.size();
+    int side = w.player == 1 ? 0 : 1;
+    for (int cell = 0; cell < size; cell++) {
+        if (w.near[cell] && w.board.is_free(cell)) w.moves.push_back(cell);
+    }
+    if (w.moves.size() == base) {
+        int centre = w.board.rows() / 2 * w.board.cols() + w.board.cols() / 2;
+        if (w.board.moves() == 0) {
+            w.moves.push_back(centre);
+        } else {
+            for (int cell = 0; cell < size; cell++) {
+                if (w.board.is_free(cell)) w.moves.push_back(cell);
+            }
+        }
+    }
+    for (size_t i = base; i < w.moves.size(); i++) {
+        int cell = w.moves[i];
+        w.order.push_back(cell == tt_move ? 1 << 30 : cell == w.killers[ply][0] ? 1 << 29
+                          : cell == w.killers[ply][1] ? 1 << 28 : w.history[cell * 2 + side]);
+    }
+
+    int best_score = -SCORE_INF;
+    int best_move = -1;
+    int bound = BOUND_UPPER;
+    for (size_t i = base; i < w.moves.size(); i++) {
+        // Bring the best ordered of the remaining moves forward
+        size_t pick = i;
+        for (size_t j = i + 1; j < w.moves.size(); j++) {
+            if (w.order[j] > w.order[pick]) pick = j;
+        }
+        swap(w.moves[i], w.moves[pick]);
+        swap(w.order[i], w.order[pick]);
+
+        int cell = w.moves[i];
+        int score;
+        Line line = w.play(cell);
+        if (line != LINE_NONE) {
+            score = SCORE_WIN - ply;
+        } else if (w.board.full()) {
+            score = 0;
+        } else {
+            score = -search(w, depth - 1, ply + 1, -beta, -alpha);
+        }
+        w.undo(cell);
+        if (stop_.load(memory_order_relaxed)) {
+            break;
+        }
+
+        if (score > best_score) {
+            best_score = score;
+            best_move = cell;
+            if (ply == 0) w.root_move = cell;
+        }
+        if (score > alpha) {
+            alpha = score;
+            bound = BOUND_EXACT;
+        }
+        if (alpha >= beta) {
+            bound = BOUND_LOWER;
+            if (w.killers[ply][0] != cell) {
+                w.killers[ply][1] = w.killers[ply][0];
+                w.killers[ply][0] = cell;
+            }
+            int& history = w.history[cell * 2 + side];
+            history += depth * depth;
+            if (history > HISTORY_MAX) {
+                for (int& h : w.history) h /= 2;
+            }
+            break;
+        }
+    }
+    w.moves.resize(base);
+    w.order.resize(base);
+    if (stop_.load(memory_order_relaxed)) {
+        return 0;
+    }
+    store(w.hash, ply, best_move, depth, best_score, bound);
+    return best_score;
+}
+
+// Function run by every thread: deepen until the limits or a proven result
+void LazySmp::iterate(Worker& w, const SearchLimits& limits) {
+    int max_depth = min(w.board.size() - w.board.moves(), MAX_PLY - 2);
+    if (limits.depth) {
+        max_depth = min(max_depth, limits.depth);
+    }
+    for (int depth = 1 + (w.id & 1); depth <= max_depth; depth++) {
+        int score = search(w, depth, 0, -SCORE_INF, SCORE_INF);
+        if (stop_.load(memory_order_relaxed)) {
+            break;
+        }
+        w.best = w.root_move;
+        w.score = score;
+        w.depth = depth;
+        if (abs(score) > SCORE_DECIDED) {
+            break;
+        }
+    }
+    if (w.id == 0) {
+        stop_.store(true, memory_order_relaxed);
+    }
+}
+
+int LazySmp::best_move(const MnkBoard& board, int player, const SearchLimits& limits, SearchStats& stats) {
+    int64_t start = now_ns();
+    prepare(board);
+    stop_.store(false, memory_order_relaxed);
+    deadline_ = limits.milliseconds ? start + (int64_t)limits.milliseconds * 1000000 : 0;
+
+    if (!table_) {
+        own_.reset(new Slot[mask_ + 1]());
+        table_ = own_.get();
+    }
+
+    unsigned threads = limits.threads ? limits.threads : 1;
+    vector<unique_ptr<Worker>> workers;
+    for (unsigned t = 0; t < threads; t++) {
+        Worker* w = new Worker(board.rows(), board.cols(), board.k());
+        w->id = t;
+        w->hash = 0;
+        w->eval = 0;
+        w->zobrist = zobrist_.data();
+        w->weights = weights_.data();
+        w->near.assign(board.size(), 0);
+        w->history.assign(board.size() * 2, 0);
+        for (int ply = 0; ply < MAX_PLY; ply++) {
+            w->killers[ply][0] = w->killers[ply][1] = -1;
+        }
+        w->nodes = 0;
+        w->root_move = w->best = -1;
+        w->score = 0;
+        w->depth = 0;
+        // Replay the stones so the hash, evaluation and neighbours follow
+        for (int cell = 0; cell < board.size(); cell++) {
+            if (board.at(cell)) {
+                w->player = board.at(cell);
+                w->play(cell);
+            }
+        }
+        w->player = player;
+        if (w->board.moves() % 2 != (player == 1 ? 0 : 1)) {
+            w->hash ^= zobrist_[board.size() * 2];   // keep the side key in step with the player
+        }
+        workers.push_back(unique_ptr<Worker>(w));
+    }
+
+    vector<thread> helpers;
+    for (unsigned t = 1; t < threads; t++) {
+        helpers.push_back(thread(&LazySmp::iterate, this, ref(*workers[t]), cref(limits)));
+    }
+    iterate(*workers[0], limits);
+    for (auto& helper : helpers) {
+        helper.join();
+    }
+
+    // The deepest completed iteration wins, thread 0 on ties
+    const Worker* chosen = workers[0].get();
+    stats.nodes = 0;
+    for (auto& w : workers) {
+        stats.nodes += w->nodes;
+        if (w->depth > chosen->depth && w->best >= 0) chosen = w.get();
+    }
+    int move = chosen->best;
+    if (move < 0) {
+        move = workers[0]->root_move;
+    }
+    if (move < 0) {
+        // Not even one move searched: the centre, or the first free cell
+        move = board.rows() / 2 * board.cols() + board.cols() / 2;
+        for (int cell = 0; cell < board.size() && !board.is_free(move); cell++) {
+            move = cell;
+        }
+    }
+    stats.depth = chosen->depth;
+    stats.score = chosen->score;
+    stats.seconds = (now_ns() - start) / 1e9;
+    return move;
+}
@@ -0,0 +1,83 @@
+#ifndef SEARCH_H
+#define SEARCH_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "mnk.h"
+
+// Budget of one alpha-beta move: stops at whichever limit is hit first
+struct SearchLimits {
+    unsigned threads;
+    int depth;              // 0 for no limit
+    unsigned milliseconds;  // 0 for no limit; a hard deadline
+};
+
+struct SearchStats {
+    uint64_t nodes;
+    int depth;              // deepest iteration completed
+    int score;              // for the side to move
+    double seconds;
+};
+
+// Iterative-deepening alpha-beta for m,n,k boards, parallelized the Lazy
+// SMP way: every thread searches the same root and they cooperate only
+// through the shared transposition table, with odd helpers starting a ply
+// deeper so the threads drift apart. A table slot is two 64-bit words, the
+// key stored XORed with the data, so a torn write reads back as a miss and
+// no lock is needed. Moves are tried table move first, then two killers per
+// ply, then by history score, and only cells within two of a stone are
+// searched. Leaves are scored by the open k-windows of each side, kept up
+// to date on every move. Thread 0 watches the deadline and stops the rest.
+class LazySmp {
+public:
+    explicit LazySmp(int table_bits = 20);
+    ~LazySmp();
+    LazySmp(const LazySmp&) = delete;
+    LazySmp& operator=(const LazySmp&) = delete;
+
+    // Function to move the transposition table into a named POSIX shared
+    // memory segment, created on first use, so that every process attached
+    // to the same name reuses the others' results. The slots are the same
+    // lock-free pairs as in a private table. The private table is only
+    // allocated by the first search without one, so attaching first skips
+    // it entirely. On failure returns false and sets error.
+    bool attach(const std::string& name, std::string& error);
+
+    // Function to empty the transposition table (a shared one for everyone)
+    void clear();
+
+    // Function to search the position for player (1 or -1) to move and
+    // return the best move of the deepest completed iteration
+    int best_move(const MnkBoard& board, int player, const SearchLimits& limits, SearchStats& stats);
+
+private:
+    struct Slot {
+        std::atomic<uint64_t> check;    // key ^ data
+        std::atomic<uint64_t> data;
+    };
+    struct Worker;
+
+    void prepare(const MnkBoard& board);
+    void iterate(Worker& worker, const SearchLimits& limits);
+    int search(Worker& worker, int depth, int ply, int alpha, int beta);
+    bool probe(uint64_t key, int ply, int& move, int& depth, int& score, int& bound) const;
+    void store(uint64_t key, int ply, int move, int depth, int score, int bound);
+
+    std::unique_ptr<Slot[]> own_;      // private table, until attach()
+    Slot* table_;                     // null until the first search or attach()
+    uint64_t mask_;
+    void* shared_;                    // mapped segment, or null
+    size_t shared_length_;
+    std::vector<uint64_t> zobrist_;   // [cell * 2 + side], side 0 = X
+    int rows_;
+    int cols_;
+    int k_;
+    std::vector<int> weights_;        // value of an open window by stone count
+    std::atomic<bool> stop_;
+    int64_t deadline_;                // steady clock, nanoseconds
+};
+
+#endif
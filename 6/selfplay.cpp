@@ -0,0 +1,261 @@
+#include "selfplay.h"
+#include "board.h"
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+using namespace std;
+
+bool parse_opponent(const string& spec, OpponentModel& opponent) {
+    if (spec == "random") {
+        opponent.type = OPPONENT_RANDOM;
+    } else if (spec == "perfect") {
+        opponent.type = OPPONENT_PERFECT;
+    } else if (spec == "all") {
+        opponent.type = OPPONENT_ALL;
+    } else if (spec.substr(0, 9) == "scripted:") {
+        string error;
+        opponent.type = OPPONENT_SCRIPTED;
+        return opponent.script.parse_classic(spec.substr(9), error);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Headless self-play
+// ---------------------------------------------------------------------------
+
+// Function to play one game and return the status it ended in
+static Status play_game(const Strategy& strategy, bool perfect, const OpponentModel& opponent, Rng& rng) {
+    uint16_t x = 0, o = 0;
+    while (true) {
+        if (perfect) {
+            x |= 1 << strategy.first_of(entry_moves(lookup(x, o)));
+        } else {
+            x |= 1 << strategy.first_of(FULL_BOARD & ~(x | o));
+        }
+        Status status = entry_status(lookup(x, o));
+        if (status != STATUS_ONGOING) return status;
+
+        uint16_t free_cells = FULL_BOARD & ~(x | o);
+        int cell;
+        switch (opponent.type) {
+            case OPPONENT_SCRIPTED:
+                cell = opponent.script.first_of(free_cells);
+                break;
+            case OPPONENT_PERFECT:
+                cell = random_cell(entry_moves(lookup(x, o)), rng);
+                break;
+            default:
+                cell = random_cell(free_cells, rng);
+                break;
+        }
+        o |= 1 << cell;
+        status = entry_status(lookup(x, o));
+        if (status != STATUS_ONGOING) return status;
+    }
+}
+
+// Function run by each simulation thread
+static void simulate_games(const Strategy& strategy, bool perfect, const OpponentModel& opponent,
+                           uint64_t games, uint64_t seed, Tally& tally) {
+    Rng rng = {seed};
+    Tally local = {0, 0, 0};
+    for (uint64_t g = 0; g < games; g++) {
+        switch (play_game(strategy, perfect, opponent, rng)) {
+            case STATUS_X_WINS: local.wins++; break;
+            case STATUS_O_WINS: local.losses++; break;
+            default: local.draws++; break;
+        }
+    }
+    tally = local;
+}
+
+SimulationReport run_simulation(const Strategy& strategy, bool perfect, const OpponentModel& opponent,
+                                uint64_t games, unsigned threads, uint64_t seed) {
+    vector<Tally> tallies(threads);
+    vector<thread> workers;
+    auto start = chrono::steady_clock::now();
+    for (unsigned t = 0; t < threads; t++) {
+        uint64_t share = games / threads + (t < games % threads ? 1 : 0);
+        workers.push_back(thread(simulate_games, cref(strategy), perfect, cref(opponent), share,
+                                 seed + t * 0x632BE59BD9B4E019ULL, ref(tallies[t])));
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    SimulationReport report;
+    report.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    report.total = {0, 0, 0};
+    for (const auto& tally : tallies) {
+        report.total.wins += tally.wins;
+        report.total.losses += tally.losses;
+        report.total.draws += tally.draws;
+    }
+    return report;
+}
+
+// ---------------------------------------------------------------------------
+// Strategy tournament: every permutation of 1-9 is scored against every
+// possible sequence of replies, or against an opponent model.
+// ---------------------------------------------------------------------------
+
+const uint32_t TOURNAMENT_CHUNK = 256;
+
+// Function to check whether an order is the smallest of its 8 symmetric
+// images. Symmetric strategies score the same against a symmetric opponent,
+// so only these representatives need to be played.
+static bool is_canonical(const int order[9]) {
+    for (int s = 1; s < 8; s++) {
+        for (int i = 0; i < 9; i++) {
+            int image = SYMMETRY[s][order[i]];
+            if (image < order[i]) return false;
+            if (image > order[i]) break;
+        }
+    }
+    return true;
+}
+
+// Function to add up every game a strategy can reach from a position with
+// X to move, each weighted by how likely the opponent model makes it
+static void tally_strategy(const int order[9], uint16_t x, uint16_t o, double weight,
+                           const OpponentModel& opponent, Outcome& outcome) {
+    int i = 0;
+    while ((x | o) & (1 << order[i])) i++;
+    x |= 1 << order[i];
+    uint16_t entry = lookup(x, o);
+    if (entry_status(entry) == STATUS_X_WINS) {
+        outcome.wins += weight;
+        return;
+    }
+    if (entry_status(entry) == STATUS_DRAW) {
+        outcome.draws += weight;
+        return;
+    }
+
+    uint16_t replies = FULL_BOARD & ~(x | o);
+    if (opponent.type == OPPONENT_PERFECT) {
+        replies = entry_moves(entry);
+    } else if (opponent.type == OPPONENT_SCRIPTED) {
+        replies = 1 << opponent.script.first_of(replies);
+    }
+    double share = (opponent.type == OPPONENT_ALL) ? weight : weight / __builtin_popcount(replies);
+    for (; replies; replies &= replies - 1) {
+        uint16_t next = o | (1 << __builtin_ctz(replies));
+        Status status = entry_status(lookup(x, next));
+        if (status == STATUS_O_WINS) {
+            outcome.losses += share;
+        } else if (status == STATUS_DRAW) {
+            outcome.draws += share;
+        } else {
+            tally_strategy(order, x, next, share, opponent, outcome);
+        }
+    }
+}
+
+// Range of permutation indices owned by one tournament worker. The owner
+// takes chunks from the front; an idle worker steals the back half.
+struct WorkRange {
+    mutex lock;
+    uint32_t begin;
+    uint32_t end;
+};
+
+// Function to take the next chunk of work for worker t, stealing if needed
+static bool next_chunk(vector<WorkRange>& ranges, unsigned t, uint32_t& begin, uint32_t& end) {
+    WorkRange& own = ranges[t];
+    {
+        lock_guard<mutex> guard(own.lock);
+        if (own.begin < own.end) {
+            begin = own.begin;
+            end = min(own.begin + TOURNAMENT_CHUNK, own.end);
+            own.begin = end;
+            return true;
+        }
+    }
+    for (unsigned k = 1; k < ranges.size(); k++) {
+        WorkRange& victim = ranges[(t + k) % ranges.size()];
+        uint32_t stolen_begin, stolen_end;
+        {
+            lock_guard<mutex> guard(victim.lock);
+            if (victim.end - victim.begin <= TOURNAMENT_CHUNK) continue;
+            stolen_begin = victim.begin + (victim.end - victim.begin) / 2;
+            stolen_end = victim.end;
+            victim.end = stolen_begin;
+        }
+        begin = stolen_begin;
+        end = min(stolen_begin + TOURNAMENT_CHUNK, stolen_end);
+        lock_guard<mutex> guard(own.lock);
+        own.begin = end;
+        own.end = stolen_end;
+        return true;
+    }
+    return false;
+}
+
+// Function run by each tournament worker
+static void tournament_worker(vector<WorkRange>& ranges, unsigned t, const OpponentModel& opponent,
+                              vector<Outcome>& outcomes, vector<char>& played) {
+    uint32_t begin, end;
+    while (next_chunk(ranges, t, begin, end)) {
+        for (uint32_t index = begin; index < end; index++) {
+            int order[9];
+            unrank_permutation(index, order);
+            // A scripted opponent is not symmetric, so nothing can be pruned
+            if (opponent.type != OPPONENT_SCRIPTED && !is_canonical(order)) continue;
+            Outcome outcome = {0, 0, 0};
+            tally_strategy(order, 0, 0, 1.0, opponent, outcome);
+            outcomes[index] = outcome;
+            played[index] = 1;
+        }
+    }
+}
+
+TournamentReport run_tournament(const OpponentModel& opponent, unsigned threads) {
+    vector<Outcome> outcomes(PERMUTATIONS);
+    vector<char> played(PERMUTATIONS, 0);
+    vector<WorkRange> ranges(threads);
+    for (unsigned t = 0; t < threads; t++) {
+        ranges[t].begin = (uint64_t)PERMUTATIONS * t / threads;
+        ranges[t].end = (uint64_t)PERMUTATIONS * (t + 1) / threads;
+    }
+
+    auto start = chrono::steady_clock::now();
+    vector<thread> workers;
+    for (unsigned t = 0; t < threads; t++) {
+        workers.push_back(thread(tournament_worker, ref(ranges), t, cref(opponent),
+                                 ref(outcomes), ref(played)));
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    vector<uint32_t> ranking;
+    for (uint32_t index = 0; index < PERMUTATIONS; index++) {
+        if (played[index]) ranking.push_back(index);
+    }
+    sort(ranking.begin(), ranking.end(), [&](uint32_t a, uint32_t b) {
+        double score_a = outcomes[a].wins - outcomes[a].losses;
+        double score_b = outcomes[b].wins - outcomes[b].losses;
+        if (score_a != score_b) return score_a > score_b;
+        if (outcomes[a].losses != outcomes[b].losses) return outcomes[a].losses < outcomes[b].losses;
+        return a < b;
+    });
+
+    TournamentReport report;
+    report.symmetric = (opponent.type != OPPONENT_SCRIPTED);
+    report.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    for (uint32_t index : ranking) {
+        int order[9];
+        unrank_permutation(index, order);
+        TournamentEntry entry;
+        for (int i = 0; i < 9; i++) entry.strategy += char('1' + order[i]);
+        entry.outcome = outcomes[index];
+        report.ranking.push_back(entry);
+    }
+    return report;
+}
@@ -0,0 +1,67 @@
+#ifndef SELFPLAY_H
+#define SELFPLAY_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "game.h"
+#include "rng.h"
+
+// Batch play on the classic board: headless self-play against an opponent
+// model, and the tournament over every strategy string.
+
+// OPPONENT_ALL (every legal reply) is only meaningful to the tournament
+enum Opponent { OPPONENT_RANDOM, OPPONENT_SCRIPTED, OPPONENT_PERFECT, OPPONENT_ALL };
+
+// An opponent model. The scripted opponent plays the first free cell of
+// its own order.
+struct OpponentModel {
+    Opponent type;
+    Strategy script;
+};
+
+// Function to parse an opponent model: random, perfect, all or
+// scripted:<order>
+bool parse_opponent(const std::string& spec, OpponentModel& opponent);
+
+// Tally of one thread, padded to its own cache line
+struct alignas(64) Tally {
+    uint64_t wins;
+    uint64_t losses;
+    uint64_t draws;
+};
+
+struct SimulationReport {
+    Tally total;
+    double seconds;
+};
+
+// Function to play a batch of games of the strategy (or the solved table
+// when perfect) as X against the opponent, spread over threads. Each thread
+// seeds its own generator from seed and its index.
+SimulationReport run_simulation(const Strategy& strategy, bool perfect, const OpponentModel& opponent,
+                                uint64_t games, unsigned threads, uint64_t seed);
+
+// Outcomes of a strategy: counts against every reply sequence, or
+// probabilities against a random/perfect/scripted opponent
+struct Outcome {
+    double wins;
+    double losses;
+    double draws;
+};
+
+struct TournamentEntry {
+    std::string strategy;
+    Outcome outcome;
+};
+
+struct TournamentReport {
+    std::vector<TournamentEntry> ranking;   // by wins minus losses
+    bool symmetric;     // each entry stands for its 8 symmetric strategies
+    double seconds;
+};
+
+// Function to score every permutation of 1-9 against the opponent
+TournamentReport run_tournament(const OpponentModel& opponent, unsigned threads);
+
+#endif
@@ -0,0 +1,312 @@
+#include "server.h"
+#include "session.h"
+#include "latency.h"
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+
+using namespace std;
+
+// Longest input line accepted before the connection is dropped
+const size_t MAX_LINE = 256;
+// Unsent output past which a connection is no longer read from, so a client
+// that sends without reading cannot grow it without bound
+const size_t MAX_PENDING = 16384;
+const int MAX_EVENTS = 256;
+
+static volatile sig_atomic_t running = 1;
+
+static void stop_handler(int) {
+    running = 0;
+}
+
+struct Connection {
+    int fd;
+    Session session;
+    string input;       // bytes of an incomplete line
+    string output;      // bytes not yet accepted by the socket
+    bool reading;       // registered for EPOLLIN
+    bool writing;       // registered for EPOLLOUT
+
+    Connection(int fd, const Game& prototype, ProtocolMode mode, GameLogWriter* log, SpectatorRing* ring)
+        : fd(fd), session(prototype, mode, log, ring), reading(true), writing(false) {
+    }
+};
+
+// Function to remove the socket file a crashed server left at path. Only a
+// socket that nobody accepts on is removed; anything else is left for bind
+// to report.
+static void remove_stale_socket(const struct sockaddr_un& addr) {
+    struct stat info;
+    if (lstat(addr.sun_path, &info) < 0 || !S_ISSOCK(info.st_mode)) {
+        return;
+    }
+    int probe = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (probe < 0) {
+        return;
+    }
+    if (connect(probe, (const struct sockaddr *)&addr, sizeof(addr)) < 0 && errno == ECONNREFUSED) {
+        unlink(addr.sun_path);
+    }
+    close(probe);
+}
+
+// Function to open the listening socket for TCPS<port> or UDSSS<path>
+static int open_listener(const string& listen_spec) {
+    int sock;
+    if (listen_spec.substr(0, 4) == "TCPS") {
+        uint64_t port;
+        if (!parse_decimal(listen_spec.c_str() + 4, 1, 65535, port)) {
+            fprintf(stderr, "Invalid TCP port: %s (expected 1-65535)\n", listen_spec.c_str() + 4);
+            return -1;
+        }
+        sock = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (sock < 0) {
+            perror("Error creating socket");
+            return -1;
+        }
+        int opt = 1;
+        setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
+        struct sockaddr_in addr = {};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        addr.sin_addr.s_addr = INADDR_ANY;
+        if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+            perror("Error binding socket");
+            close(sock);
+            return -1;
+        }
+    } else if (listen_spec.substr(0, 5) == "UDSSS") {
+        string path = listen_spec.substr(5);
+        struct sockaddr_un addr = {};
+        if (path.empty() || path.length() >= sizeof(addr.sun_path)) {
+            fprintf(stderr, "Invalid Unix domain socket path\n");
+            return -1;
+        }
+        sock = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (sock < 0) {
+            perror("Error creating Unix domain socket");
+            return -1;
+        }
+        addr.sun_family = AF_UNIX;
+        strcpy(addr.sun_path, path.c_str());
+        remove_stale_socket(addr);
+        if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+            perror("Error binding Unix domain socket");
+            close(sock);
+            return -1;
+        }
+    } else {
+        fprintf(stderr, "Expected TCPS<port> or UDSSS<path>\n");
+        return -1;
+    }
+
+    if (listen(sock, SOMAXCONN) < 0) {
+        perror("Error listening on socket");
+        close(sock);
+        return -1;
+    }
+    return sock;
+}
+
+// Function to send as much pending output as the socket takes. Returns
+// false when the connection is gone.
+static bool flush_output(Connection& conn) {
+    LatencyTimer timer(PROBE_FLUSH);
+    size_t done = 0;
+    while (done < conn.output.length()) {
+        ssize_t n = send(conn.fd, conn.output.data() + done, conn.output.length() - done, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+        if (n <= 0) return false;
+        done += n;
+    }
+    conn.output.erase(0, done);
+    return true;
+}
+
+// Function to parse one input line: the number it holds, or 0 unless the
+// line is a number and nothing else but blanks
+static int parse_move(const string& line) {
+    const char* p = line.c_str();
+    while (*p == ' ' || *p == '\t' || *p == '\r') p++;
+    if (*p < '0' || *p > '9') return 0;
+    char* end;
+    errno = 0;
+    long num = strtol(p, &end, 10);
+    while (*end == ' ' || *end == '\t' || *end == '\r') end++;
+    if (*end != '\0' || errno == ERANGE) return 0;
+    return (num > 0 && num <= 1000000) ? (int)num : 0;
+}
+
+// Function to consume the complete lines in a connection's input. Returns
+// false when the connection should be dropped.
+static bool handle_input(Connection& conn, const char* data, size_t length) {
+    conn.input.append(data, length);
+    size_t start = 0;
+    size_t newline;
+    while ((newline = conn.input.find('\n', start)) != string::npos) {
+        conn.session.input(parse_move(conn.input.substr(start, newline - start)), conn.output);
+        start = newline + 1;
+        if (conn.session.finished()) break;
+    }
+    conn.input.erase(0, start);
+    return conn.input.length() <= MAX_LINE;
+}
+
+// Function to flush a connection after it made progress, then either close
+// it or wait for more input (and for room to write while output is
+// pending). Input waits while too much output is pending. Returns false
+// once the connection has been closed.
+static bool settle(int epoll_fd, vector<Connection*>& connections, Connection* conn, bool alive) {
+    if (alive) {
+        alive = flush_output(*conn);
+    }
+    // A finished game closes once its last frame is out
+    if (alive && conn->session.finished() && conn->output.empty()) {
+        alive = false;
+    }
+    if (!alive) {
+        flush_output(*conn);   // best effort for a client that stopped sending
+        epoll_ctl(epoll_fd, EPOLL_CTL_DEL, conn->fd, nullptr);
+        close(conn->fd);
+        connections[conn->fd] = nullptr;
+        delete conn;
+        return false;
+    }
+
+    bool pending = !conn->output.empty();
+    bool reading = conn->output.length() <= MAX_PENDING;
+    if (pending != conn->writing || reading != conn->reading) {
+        struct epoll_event event = {};
+        event.events = (reading ? (uint32_t)(EPOLLIN | EPOLLRDHUP) : 0u) | (pending ? (uint32_t)EPOLLOUT : 0u);
+        event.data.fd = conn->fd;
+        epoll_ctl(epoll_fd, EPOLL_CTL_MOD, conn->fd, &event);
+        conn->writing = pending;
+        conn->reading = reading;
+    }
+    return true;
+}
+
+bool run_server(const string& listen_spec, const Game& prototype, ProtocolMode mode, GameLogWriter* log,
+                SpectatorRing* ring) {
+    // Allow as many connections as the hard limit permits
+    struct rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+    signal(SIGPIPE, SIG_IGN);
+    signal(SIGINT, stop_handler);
+    signal(SIGTERM, stop_handler);
+
+    int listener = open_listener(listen_spec);
+    if (listener < 0) {
+        return false;
+    }
+    int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd < 0) {
+        perror("Error creating epoll instance");
+        close(listener);
+        return false;
+    }
+    struct epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.fd = listener;
+    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, listener, &event);
+
+    // Held back so a client can still be accepted, and refused, when the
+    // process has run out of descriptors
+    int reserve = open("/dev/null", O_RDONLY | O_CLOEXEC);
+
+    // Connections indexed by their file descriptor
+    vector<Connection*> connections;
+    struct epoll_event events[MAX_EVENTS];
+    char buffer[4096];
+
+    while (running) {
+        int ready = epoll_wait(epoll_fd, events, MAX_EVENTS, -1);
+        if (ready < 0) {
+            if (errno == EINTR) continue;
+            perror("Error in epoll_wait");
+            break;
+        }
+
+        for (int e = 0; e < ready; e++) {
+            int fd = events[e].data.fd;
+            if (fd == listener) {
+                while (true) {
+                    int client = accept4(listener, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+                    if (client < 0 && (errno == EINTR || errno == ECONNABORTED)) continue;
+                    if (client < 0 && (errno == EMFILE || errno == ENFILE) && reserve >= 0) {
+                        // Out of descriptors: spend the reserve to take the
+                        // client off the queue and hang up on it, or the
+                        // listener stays readable and epoll_wait spins
+                        close(reserve);
+                        int dropped = accept4(listener, nullptr, nullptr, SOCK_CLOEXEC);
+                        reserve = open("/dev/null", O_RDONLY | O_CLOEXEC);
+                        if (dropped < 0) break;
+                        close(dropped);
+                        continue;
+                    }
+                    if (client < 0) break;
+                    if ((size_t)client >= connections.size()) {
+                        connections.resize(client + 1, nullptr);
+                    }
+                    Connection* conn = new Connection(client, prototype, mode, log, ring);
+                    connections[client] = conn;
+                    struct epoll_event client_event = {};
+                    client_event.events = EPOLLIN | EPOLLRDHUP;
+                    client_event.data.fd = client;
+                    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, client, &client_event);
+                    conn->session.start(conn->output);
+                    settle(epoll_fd, connections, conn, true);
+                }
+                continue;
+            }
+
+            Connection* conn = connections[fd];
+            if (!conn) continue;
+            bool alive = true;
+            if (conn->reading && (events[e].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR))) {
+                ssize_t n = read(fd, buffer, sizeof(buffer));
+                if (n > 0) {
+                    alive = handle_input(*conn, buffer, n);
+                } else if (n == 0 || (errno != EAGAIN && errno != EINTR)) {
+                    alive = false;
+                }
+            }
+            settle(epoll_fd, connections, conn, alive);
+        }
+    }
+
+    for (Connection* conn : connections) {
+        if (conn) {
+            close(conn->fd);
+            delete conn;
+        }
+    }
+    if (reserve >= 0) {
+        close(reserve);
+    }
+    close(epoll_fd);
+    close(listener);
+    if (log) {
+        log->flush();
+    }
+    if (listen_spec.substr(0, 5) == "UDSSS") {
+        unlink(listen_spec.c_str() + 5);
+    }
+    return true;
+}
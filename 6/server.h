@@ -0,0 +1,21 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <string>
+#include "game.h"
+#include "gamelog.h"
+#include "spectate.h"
+#include "protocol.h"
+
+// Multi-session game server: one process, one epoll loop, one Session per
+// connection. listen is TCPS<port> or UDSSS<path> (the mync names). Every
+// connection plays its own copy of the prototype game; each input line is
+// one move, and the AI replies inline, so its engine must be one that
+// answers at once (strategy, solved table, tablebase or policy). Finished
+// classic games go to the log, if given, which is flushed on the way out,
+// and every move to the spectator ring, if given. Runs until
+// SIGINT/SIGTERM; returns false if it cannot listen.
+bool run_server(const std::string& listen, const Game& prototype, ProtocolMode mode,
+                GameLogWriter* log = nullptr, SpectatorRing* ring = nullptr);
+
+#endif
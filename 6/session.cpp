@@ -0,0 +1,174 @@
+#include "session.h"
+#include "latency.h"
+#include <chrono>
+
+using namespace std;
+
+// Function to read the wall clock in milliseconds since the epoch
+static int64_t now_ms() {
+    return chrono::duration_cast<chrono::milliseconds>(chrono::system_clock::now().time_since_epoch()).count();
+}
+
+Session::Session(const Game& game, ProtocolMode mode, GameLogWriter* log, SpectatorRing* ring)
+    : game_(game), mode_(mode), log_(game.classic() ? log : nullptr), ring_(ring), game_number_(0),
+      started_ms_(0) {
+}
+
+// Function to publish an event of this game to the spectators
+void Session::publish(SpectatorEventKind kind, int cell, int player, Result result) {
+    SpectatorEvent event;
+    event.game = game_number_;
+    event.cell = cell;
+    event.rows = game_.rows();
+    event.cols = game_.cols();
+    event.k = game_.k();
+    event.kind = kind;
+    event.player = player;
+    event.result = result;
+    event.reserved = 0;
+    ring_->publish(event);
+}
+
+// Function to play a move, recording it for the log and the spectators
+Result Session::play(int cell) {
+    int before = game_.moves();
+    int player = game_.ai_to_move() ? 1 : 2;
+    Result result;
+    {
+        // Only the rules: the log and the ring below are not the board check
+        LatencyTimer timer(PROBE_CHECK_BOARD);
+        result = game_.play(cell);
+    }
+    if (!log_ && !ring_) {
+        return result;
+    }
+    if (game_.moves() == before) {
+        return result;
+    }
+    if (ring_) {
+        publish(EVENT_MOVE, cell, player, result);
+    }
+    if (!log_) {
+        return result;
+    }
+    if (before == 0) {
+        started_ms_ = now_ms();
+    }
+    history_[before] = cell;
+    if (result != RESULT_ONGOING) {
+        int64_t finished_ms = now_ms();
+        log_->append(make_record(game_.strategy(), game_.mode() == AI_PERFECT, history_, game_.moves(), result,
+                                 started_ms_ / 1000, finished_ms - started_ms_));
+    }
+    return result;
+}
+
+void Session::start(string& out) {
+    if (ring_) {
+        game_number_ = ring_->next_game();
+        publish(EVENT_START, 0, 0, RESULT_ONGOING);
+    }
+    if (mode_ == PROTOCOL_NONE && game_.classic()) {
+        for (int i = 0; i < 9; i++) {
+            out += to_string(game_.strategy().at(i) + 1) + " ";
+        }
+        out += "\n";
+    }
+    ai_turn(out);
+    prompt(out);
+}
+
+// Function to play the AI's move and append its output
+void Session::ai_turn(string& out) {
+    int num;
+    {
+        LatencyTimer timer(PROBE_AI_MOVE);
+        num = game_.choose_ai_move();
+    }
+    if (mode_ != PROTOCOL_NONE) {
+        append_move(out, mode_, 1, num, play(num));
+        return;
+    }
+
+    // The classic strategy AI reports every cell it tried
+    const Strategy& strategy = game_.strategy();
+    int first = (game_.classic() && game_.mode() == AI_STRATEGY) ? 0 : strategy.rank(num);
+    for (int i = first; i <= strategy.rank(num); i++) {
+        int cell = strategy.at(i);
+
+        // Debugging: Print AI move information
+        out += "AI move: i = " + to_string(i) + ", num = " + to_string(cell) + ", row = " +
+               to_string(cell / game_.cols()) + ", col = " + to_string(cell % game_.cols()) + "\n";
+    }
+    play(num);
+    check_board(out);
+}
+
+// Function to append the board state and, once the game is over, the
+// win, lose, or draw message
+void Session::check_board(string& out) {
+    LatencyTimer timer(PROBE_RENDER);
+
+    // Debugging: Print the board state after each move
+    out += "Board state after move:\n" + game_.render();
+
+    Result result = game_.result();
+    if (result == RESULT_AI_WINS || result == RESULT_HUMAN_WINS) {
+        bool ai_line = (result == RESULT_AI_WINS);
+        if (game_.line() == LINE_ROW) {
+            out += ai_line ? "I WIN\n" : "I LOSE\n";
+            out += "good game\n";
+        } else {
+            out += ai_line ? "WIN\n" : "LOSE\n";
+            out += "gg\n";
+        }
+    } else if (result == RESULT_DRAW) {
+        out += "DRAW\n";
+    }
+}
+
+void Session::prompt(string& out) {
+    if (mode_ == PROTOCOL_NONE && !finished()) {
+        out += "Enter your move (1-" + to_string(game_.size()) + "): ";
+    }
+}
+
+void Session::input(int num, string& out) {
+    if (finished()) {
+        return;
+    }
+    int size = game_.size();
+
+    if (mode_ != PROTOCOL_NONE) {
+        if (num < 1 || num > size || !game_.is_legal(num - 1)) {
+            append_move(out, mode_, 0, 0, RESULT_ILLEGAL_MOVE);
+            return;
+        }
+        append_move(out, mode_, -1, num - 1, play(num - 1));
+        if (!finished()) {
+            ai_turn(out);
+        }
+        return;
+    }
+
+    if (num < 1 || num > size) {
+        out += "Invalid input. Please enter a number between 1 and " + to_string(size) + ".\n";
+        prompt(out);
+        return;
+    }
+
+    // Debugging: Print human move information
+    out += "Human move: num = " + to_string(num) + ", row = " + to_string((num - 1) / game_.cols() + 1) +
+           ", col = " + to_string((num - 1) % game_.cols() + 1) + "\n";
+
+    if (play(num - 1) == RESULT_ILLEGAL_MOVE) {
+        out += "Invalid move. The cell is already occupied. Try again.\n";
+        prompt(out);
+        return;
+    }
+    check_board(out);
+    if (!finished()) {
+        ai_turn(out);
+    }
+    prompt(out);
+}
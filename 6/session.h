@@ -0,0 +1,47 @@
+#ifndef SESSION_H
+#define SESSION_H
+
+#include <cstdint>
+#include <string>
+#include "game.h"
+#include "gamelog.h"
+#include "spectate.h"
+#include "protocol.h"
+
+// Text side of one game: turns the human's numbers into the frames (or the
+// protocol records) the player sees. The ttt CLI and the game server both
+// drive their games through it. With a log, each finished classic game is
+// appended to it; with a spectator ring, every move is published to it.
+// Both must outlive the session.
+class Session {
+public:
+    Session(const Game& game, ProtocolMode mode, GameLogWriter* log = nullptr, SpectatorRing* ring = nullptr);
+
+    // Function to append the opening output: the strategy line, the AI's
+    // first move and the first prompt
+    void start(std::string& out);
+
+    // Function to feed the human's next number, 0 for unreadable input,
+    // and append everything up to the next prompt or the end of the game
+    void input(int num, std::string& out);
+
+    bool finished() const { return game_.result() != RESULT_ONGOING; }
+    const Game& game() const { return game_; }
+
+private:
+    void ai_turn(std::string& out);
+    void check_board(std::string& out);
+    void prompt(std::string& out);
+    Result play(int cell);
+    void publish(SpectatorEventKind kind, int cell, int player, Result result);
+
+    Game game_;
+    ProtocolMode mode_;
+    GameLogWriter* log_;
+    SpectatorRing* ring_;
+    uint32_t game_number_;  // in the spectator ring
+    int history_[9];        // classic board: cells played so far
+    int64_t started_ms_;    // unix time of the first move
+};
+
+#endif
@@ -0,0 +1,221 @@
+#include "spectate.h"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+
+static_assert(sizeof(SpectatorEvent) == 16, "an event is two words");
+
+// Slots start on their own cache line after the header
+const size_t SPECTATOR_OFFSET = 128;
+// Polls a reader waits on a claimed event before taking its publisher for
+// dead and skipping it, and a publisher waits on a slot another publisher
+// still holds before taking it over
+const uint64_t STALL_POLLS = 1000;
+
+static size_t ring_length(uint64_t capacity) {
+    return SPECTATOR_OFFSET + capacity * sizeof(SpectatorSlot);
+}
+
+static string segment_path(const string& name) {
+    return (name[0] == '/') ? name : "/" + name;
+}
+
+// ---------------------------------------------------------------------------
+// Publisher
+// ---------------------------------------------------------------------------
+
+SpectatorRing::SpectatorRing() : header_(nullptr), slots_(nullptr), length_(0) {
+}
+
+SpectatorRing::~SpectatorRing() {
+    if (header_) {
+        munmap(header_, length_);
+    }
+}
+
+bool SpectatorRing::open(const string& name, string& error) {
+    string path = segment_path(name);
+    int fd = shm_open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        error = "Cannot open spectator ring " + path + ": " + strerror(errno);
+        return false;
+    }
+    // Held only while the ring is checked and, if need be, laid out, so two
+    // publishers starting together do not both lay it out
+    if (flock(fd, LOCK_EX) < 0) {
+        error = "Cannot lock spectator ring " + path + ": " + strerror(errno);
+        close(fd);
+        return false;
+    }
+
+    // Anything but a ring of our layout is wiped and laid out afresh
+    size_t length = ring_length(SPECTATOR_CAPACITY);
+    struct stat st;
+    bool reuse = fstat(fd, &st) == 0 && (size_t)st.st_size == length;
+    if (!reuse && (ftruncate(fd, 0) < 0 || ftruncate(fd, length) < 0)) {
+        error = "Cannot size spectator ring " + path + ": " + strerror(errno);
+        close(fd);
+        return false;
+    }
+    void* map = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED) {
+        error = "Cannot map spectator ring " + path + ": " + strerror(errno);
+        close(fd);
+        return false;
+    }
+    SpectatorHeader* header = (SpectatorHeader*)map;
+    if (!reuse || header->magic.load(memory_order_acquire) != SPECTATOR_MAGIC ||
+        header->capacity != SPECTATOR_CAPACITY) {
+        // Zeroed slots are free to every publisher and no reader takes them
+        // for an event
+        header->magic.store(0, memory_order_relaxed);
+        SpectatorSlot* slots = (SpectatorSlot*)((char*)map + SPECTATOR_OFFSET);
+        for (uint64_t i = 0; i < SPECTATOR_CAPACITY; i++) {
+            slots[i].seq.store(0, memory_order_relaxed);
+        }
+        header->capacity = SPECTATOR_CAPACITY;
+        header->games.store(0, memory_order_relaxed);
+        header->head.store(0, memory_order_relaxed);
+        header->magic.store(SPECTATOR_MAGIC, memory_order_release);
+    }
+
+    close(fd);      // drops the lock
+
+    if (header_) {
+        munmap(header_, length_);
+    }
+    header_ = header;
+    slots_ = (SpectatorSlot*)((char*)map + SPECTATOR_OFFSET);
+    length_ = length;
+    return true;
+}
+
+void SpectatorRing::publish(const SpectatorEvent& event) {
+    uint64_t words[2];
+    memcpy(words, &event, sizeof(words));
+    uint64_t n = header_->head.fetch_add(1, memory_order_acq_rel) + 1;
+    SpectatorSlot& slot = slots_[n & (SPECTATOR_CAPACITY - 1)];
+
+    // Claim the slot from an older event. A publisher of the lap before
+    // that is still writing it is waited for, and taken for dead after
+    // STALL_POLLS without progress; one of a later lap means event n was
+    // overwritten before it was written, and it is dropped.
+    uint64_t seq = slot.seq.load(memory_order_relaxed);
+    uint64_t polls = 0;
+    while ((seq & ~SPECTATOR_WRITING) < n) {
+        if (!(seq & SPECTATOR_WRITING) || polls >= STALL_POLLS) {
+            if (slot.seq.compare_exchange_strong(seq, n | SPECTATOR_WRITING, memory_order_relaxed)) {
+                atomic_thread_fence(memory_order_release);
+                slot.words[0].store(words[0], memory_order_relaxed);
+                slot.words[1].store(words[1], memory_order_relaxed);
+                // Fails only if the slot was taken over meanwhile
+                uint64_t claimed = n | SPECTATOR_WRITING;
+                slot.seq.compare_exchange_strong(claimed, n, memory_order_release, memory_order_relaxed);
+                return;
+            }
+            polls = 0;
+            continue;
+        }
+        sched_yield();
+        uint64_t now = slot.seq.load(memory_order_relaxed);
+        polls = (now == seq) ? polls + 1 : 0;
+        seq = now;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Reader
+// ---------------------------------------------------------------------------
+
+SpectatorReader::SpectatorReader()
+    : header_(nullptr), slots_(nullptr), length_(0), next_(1), lost_(0), stalled_(0) {
+}
+
+SpectatorReader::~SpectatorReader() {
+    if (header_) {
+        munmap((void*)header_, length_);
+    }
+}
+
+bool SpectatorReader::open(const string& name, string& error) {
+    string path = segment_path(name);
+    int fd = shm_open(path.c_str(), O_RDONLY | O_CLOEXEC, 0);
+    if (fd < 0) {
+        error = "Cannot open spectator ring " + path + ": " + strerror(errno);
+        return false;
+    }
+    size_t length = ring_length(SPECTATOR_CAPACITY);
+    struct stat st;
+    if (fstat(fd, &st) < 0 || (size_t)st.st_size != length) {
+        error = "Spectator ring " + path + " has an unexpected layout";
+        close(fd);
+        return false;
+    }
+    void* map = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        error = "Cannot map spectator ring " + path + ": " + strerror(errno);
+        return false;
+    }
+    const SpectatorHeader* header = (const SpectatorHeader*)map;
+    if (header->magic.load(memory_order_acquire) != SPECTATOR_MAGIC || header->capacity != SPECTATOR_CAPACITY) {
+        error = "Spectator ring " + path + " has an unexpected layout";
+        munmap(map, length);
+        return false;
+    }
+
+    if (header_) {
+        munmap((void*)header_, length_);
+    }
+    header_ = header;
+    slots_ = (const SpectatorSlot*)((const char*)map + SPECTATOR_OFFSET);
+    length_ = length;
+    uint64_t head = header->head.load(memory_order_acquire);
+    next_ = (head >= SPECTATOR_CAPACITY) ? head - SPECTATOR_CAPACITY + 1 : 1;
+    lost_ = 0;
+    stalled_ = 0;
+    return true;
+}
+
+bool SpectatorReader::next(SpectatorEvent& event) {
+    while (true) {
+        uint64_t head = header_->head.load(memory_order_acquire);
+        if (next_ > head) return false;
+        if (head - next_ >= SPECTATOR_CAPACITY) {
+            // Lapped: the oldest event still in the ring is the next one
+            lost_ += head - SPECTATOR_CAPACITY + 1 - next_;
+            next_ = head - SPECTATOR_CAPACITY + 1;
+        }
+
+        const SpectatorSlot& slot = slots_[next_ & (SPECTATOR_CAPACITY - 1)];
+        uint64_t before = slot.seq.load(memory_order_acquire);
+        uint64_t words[2];
+        words[0] = slot.words[0].load(memory_order_relaxed);
+        words[1] = slot.words[1].load(memory_order_relaxed);
+        atomic_thread_fence(memory_order_acquire);
+        uint64_t after = slot.seq.load(memory_order_relaxed);
+        if (before == next_ && after == next_) {
+            memcpy(&event, words, sizeof(event));
+            next_++;
+            stalled_ = 0;
+            return true;
+        }
+        if (after == next_) {
+            continue;       // written while we read it: read it again
+        }
+        if ((after & ~SPECTATOR_WRITING) <= next_ && ++stalled_ < STALL_POLLS) {
+            return false;   // claimed, and its publisher is still writing it
+        }
+        // Overwritten by a later lap, or its publisher died writing it
+        lost_++;
+        next_++;
+        stalled_ = 0;
+    }
+}
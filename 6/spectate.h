@@ -0,0 +1,106 @@
+#ifndef SPECTATE_H
+#define SPECTATE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Spectator channel: any number of publishing processes (ttt --spectate,
+// one per game under mync, or a server) write every game's moves into a
+// ring in POSIX shared memory, and any number of readers (ttt --watch, or
+// anything else mapping the ring) follow it. Publishers claim event numbers
+// with an atomic add and never wait for each other or for readers; readers
+// never write to the ring. A reader that falls a full ring behind skips
+// ahead and is told how many events it lost.
+enum SpectatorEventKind : uint8_t { EVENT_START, EVENT_MOVE };
+
+// Every event carries the board shape, so a reader joining mid-game can
+// still draw it
+struct SpectatorEvent {
+    uint32_t game;          // numbered from 1 across all publishers
+    uint16_t cell;          // EVENT_MOVE: cell numbered from 0
+    uint16_t rows;
+    uint16_t cols;
+    uint16_t k;
+    SpectatorEventKind kind;
+    uint8_t player;         // EVENT_MOVE: 1 = AI (X), 2 = human (O)
+    uint8_t result;         // EVENT_MOVE: Result after the move
+    uint8_t reserved;
+};
+
+const uint64_t SPECTATOR_MAGIC = 0x5454545350454331ULL;   // "TTTSPEC1"
+const uint64_t SPECTATOR_CAPACITY = 1 << 16;               // events kept
+
+// Slot of the ring. Event n is written to slot n % capacity under a
+// sequence lock: its publisher claims the slot by swapping an older seq for
+// n | SPECTATOR_WRITING, so publishers a lap apart never write it together,
+// and stores n once the words hold event n. Until then a reader finds a
+// smaller or marked seq there and waits.
+const uint64_t SPECTATOR_WRITING = 1ULL << 63;
+
+struct SpectatorSlot {
+    std::atomic<uint64_t> seq;
+    std::atomic<uint64_t> words[2];
+    uint64_t reserved;
+};
+
+struct SpectatorHeader {
+    std::atomic<uint64_t> magic;
+    uint64_t capacity;
+    std::atomic<uint32_t> games;               // last game number handed out
+    alignas(64) std::atomic<uint64_t> head;    // last event claimed
+};
+
+// Publishing side. A ring of the right layout is reused, its numbering
+// continued, so readers outlive publishers and publishers come and go; the
+// segment is only laid out afresh, under a lock, when it is new or foreign.
+class SpectatorRing {
+public:
+    SpectatorRing();
+    ~SpectatorRing();
+    SpectatorRing(const SpectatorRing&) = delete;
+    SpectatorRing& operator=(const SpectatorRing&) = delete;
+
+    // Function to create or join a ring; on failure returns false and sets
+    // error to the message the CLI prints
+    bool open(const std::string& name, std::string& error);
+
+    // Function to hand out the number of a new game
+    uint32_t next_game() { return header_->games.fetch_add(1, std::memory_order_relaxed) + 1; }
+
+    void publish(const SpectatorEvent& event);
+
+private:
+    SpectatorHeader* header_;
+    SpectatorSlot* slots_;
+    size_t length_;
+};
+
+// Reading side. Starts at the oldest event still in the ring.
+class SpectatorReader {
+public:
+    SpectatorReader();
+    ~SpectatorReader();
+    SpectatorReader(const SpectatorReader&) = delete;
+    SpectatorReader& operator=(const SpectatorReader&) = delete;
+
+    bool open(const std::string& name, std::string& error);
+
+    // Function to fetch the next event; false when caught up with the
+    // publishers, or while the next event is still being written
+    bool next(SpectatorEvent& event);
+
+    // Events overwritten before this reader got to them
+    uint64_t lost() const { return lost_; }
+
+private:
+    const SpectatorHeader* header_;
+    const SpectatorSlot* slots_;
+    size_t length_;
+    uint64_t next_;
+    uint64_t lost_;
+    uint64_t stalled_;      // polls the next event has been claimed but unwritten
+};
+
+#endif
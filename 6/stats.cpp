@@ -0,0 +1,254 @@
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <cstdint>
+#include "board.h"
+#include "game.h"
+#include "gamelog.h"
+
+using namespace std;
+
+// Aggregates over a game log written by ttt --log. The log is mapped and
+// split into one contiguous range per thread; each thread counts into its
+// own tables and the tables are summed at the end, so the scan shares
+// nothing but the read-only mapping.
+//
+//   tttstats <log> [prefix-length] [threads]
+
+const int BLOCK = 256;          // records decoded at a time
+const int MAX_PREFIX = 4;       // prefixes index a table of 16^k entries
+const size_t TOP = 20;          // rows printed per ranking
+// Each thread counts into tables of over 11MB
+const unsigned MAX_THREADS = 64;
+
+// Counts by key, four per key: index 0 is unused, then Result order
+// (AI wins, human wins, draws), so a record adds 1 at key * 4 + result.
+struct Counts {
+    vector<uint64_t> opening;
+    vector<uint64_t> strategy;
+    vector<uint64_t> prefix;
+    vector<uint64_t> visits;        // human to move, by solved-table index
+    vector<uint64_t> blunders;      // ... and threw away a won or drawn game
+    uint64_t games;
+    uint64_t skipped;
+
+    explicit Counts(int prefix_length)
+        : opening(9 * 4), strategy(PERMUTATIONS * 4), prefix((1 << (4 * prefix_length)) * 4),
+          visits(POSITIONS), blunders(POSITIONS), games(0), skipped(0) {
+    }
+
+    void add(const Counts& other) {
+        for (size_t i = 0; i < opening.size(); i++) opening[i] += other.opening[i];
+        for (size_t i = 0; i < strategy.size(); i++) strategy[i] += other.strategy[i];
+        for (size_t i = 0; i < prefix.size(); i++) prefix[i] += other.prefix[i];
+        for (size_t i = 0; i < visits.size(); i++) visits[i] += other.visits[i];
+        for (size_t i = 0; i < blunders.size(); i++) blunders[i] += other.blunders[i];
+        games += other.games;
+        skipped += other.skipped;
+    }
+};
+
+// Function to find the value of a position for O once O has moved
+static Value value_for_o(uint16_t x, uint16_t o) {
+    uint16_t entry = lookup(x, o);
+    switch (entry_status(entry)) {
+        case STATUS_O_WINS: return VALUE_WIN;
+        case STATUS_DRAW: return VALUE_DRAW;
+        default: return Value(VALUE_WIN - entry_value(entry));
+    }
+}
+
+// Function to replay a game through the solved table and count the human
+// moves that made O's game-theoretic value worse
+static void replay(uint64_t word, int moves, Counts& counts) {
+    uint16_t x = 0, o = 0;
+    for (int i = 0; i < moves; i++) {
+        uint16_t bit = 1 << ((word >> (4 * i)) & 0xF);
+        if (i % 2 == 0) {
+            x |= bit;
+            continue;
+        }
+        int position = POSITION_BASE3[x] + 2 * POSITION_BASE3[o];
+        Value before = entry_value(SOLVED_TABLE[position]);
+        o |= bit;
+        counts.visits[position]++;
+        if (value_for_o(x, o) < before) {
+            counts.blunders[position]++;
+        }
+    }
+}
+
+// Function to count the records of one range
+static void scan(const GameRecord* begin, const GameRecord* end, int prefix_length, Counts& counts) {
+    int32_t prefix_mask = (1 << (4 * prefix_length)) - 1;
+    int32_t low[BLOCK] = {}, high[BLOCK] = {};
+    int32_t opening[BLOCK], strategy[BLOCK], prefix[BLOCK], result[BLOCK], moves[BLOCK], valid[BLOCK];
+
+    for (const GameRecord* block = begin; block < end; block += BLOCK) {
+        int n = min<ptrdiff_t>(BLOCK, end - block);
+        for (int i = 0; i < n; i++) {
+            low[i] = block[i].word;
+            high[i] = block[i].word >> 32;
+        }
+
+        // Decode a whole block into arrays of 32-bit lanes: shifts, masks
+        // and signed compares of small values only, with no branches and a
+        // fixed trip count, so the compiler turns this into SSE2 code even
+        // at -O2. Lanes past n hold stale values and are never read.
+        for (int i = 0; i < BLOCK; i++) {
+            opening[i] = low[i] & 0xF;
+            prefix[i] = low[i] & prefix_mask;
+            moves[i] = (high[i] >> 4) & 0xF;
+            strategy[i] = (high[i] >> 8) & 0x7FFFF;
+            result[i] = (high[i] >> 27) & 0x3;
+            valid[i] = (result[i] != 0) & (moves[i] >= 5) & (moves[i] <= 9) & (strategy[i] < (int32_t)PERMUTATIONS);
+        }
+
+        for (int i = 0; i < n; i++) {
+            if (!valid[i]) {
+                counts.skipped++;
+                continue;
+            }
+            // Every cell of a game must be on the board before it is replayed
+            uint64_t word = block[i].word;
+            uint16_t seen = 0;
+            for (int m = 0; m < moves[i]; m++) seen |= 1 << ((word >> (4 * m)) & 0xF);
+            if (__builtin_popcount(seen & FULL_BOARD) != moves[i]) {
+                counts.skipped++;
+                continue;
+            }
+            counts.games++;
+            counts.opening[opening[i] * 4 + result[i]]++;
+            counts.strategy[strategy[i] * 4 + result[i]]++;
+            if (moves[i] >= prefix_length) {
+                counts.prefix[prefix[i] * 4 + result[i]]++;
+            }
+            replay(word, moves[i], counts);
+        }
+    }
+}
+
+// Function to print one ranking row: games, AI wins, human wins, draws and
+// the AI's win rate
+static void print_row(const string& key, const uint64_t* counts) {
+    uint64_t games = counts[RESULT_AI_WINS] + counts[RESULT_HUMAN_WINS] + counts[RESULT_DRAW];
+    cout << key << " " << games << " " << counts[RESULT_AI_WINS] << " " << counts[RESULT_HUMAN_WINS] << " "
+         << counts[RESULT_DRAW] << " " << (games ? 100.0 * counts[RESULT_AI_WINS] / games : 0.0) << "%\n";
+}
+
+// Function to print the keys with the most games, most first
+static void print_top(const string& title, const vector<uint64_t>& counts, string (*name)(uint32_t, int),
+                      int prefix_length) {
+    vector<uint32_t> keys;
+    for (uint32_t key = 0; key < counts.size() / 4; key++) {
+        if (counts[key * 4 + 1] + counts[key * 4 + 2] + counts[key * 4 + 3]) keys.push_back(key);
+    }
+    auto games = [&](uint32_t key) { return counts[key * 4 + 1] + counts[key * 4 + 2] + counts[key * 4 + 3]; };
+    size_t shown = min(TOP, keys.size());
+    partial_sort(keys.begin(), keys.begin() + shown, keys.end(), [&](uint32_t a, uint32_t b) {
+        return games(a) != games(b) ? games(a) > games(b) : a < b;
+    });
+    cout << "\n# " << title << " games wins losses draws win%\n";
+    for (size_t i = 0; i < shown; i++) {
+        print_row(name(keys[i], prefix_length), &counts[keys[i] * 4]);
+    }
+}
+
+static string opening_name(uint32_t key, int) {
+    return to_string(key + 1);
+}
+
+static string strategy_name(uint32_t key, int) {
+    int order[9];
+    unrank_permutation(key, order);
+    string name;
+    for (int i = 0; i < 9; i++) name += char('1' + order[i]);
+    return name;
+}
+
+static string prefix_name(uint32_t key, int prefix_length) {
+    string name;
+    for (int i = 0; i < prefix_length; i++) name += char('1' + ((key >> (4 * i)) & 0xF));
+    return name;
+}
+
+// Function to print the positions where the human most often blunders,
+// rows separated by '/', X for the AI and O for the human
+static void print_blunders(const Counts& counts) {
+    vector<pair<uint16_t, uint16_t>> positions;
+    vector<uint64_t> found;
+    for (int x = 0; x < 512; x++) {
+        for (int o = 0; o < 512; o++) {
+            if (x & o) continue;
+            int position = POSITION_BASE3[x] + 2 * POSITION_BASE3[o];
+            if (counts.blunders[position]) {
+                positions.push_back(make_pair(x, o));
+                found.push_back(counts.blunders[position]);
+            }
+        }
+    }
+    vector<size_t> ranking(positions.size());
+    for (size_t i = 0; i < ranking.size(); i++) ranking[i] = i;
+    size_t shown = min(TOP, ranking.size());
+    partial_sort(ranking.begin(), ranking.begin() + shown, ranking.end(), [&](size_t a, size_t b) {
+        return found[a] != found[b] ? found[a] > found[b] : a < b;
+    });
+
+    cout << "\n# position blunders reached blunder%\n";
+    for (size_t r = 0; r < shown; r++) {
+        uint16_t x = positions[ranking[r]].first, o = positions[ranking[r]].second;
+        string board;
+        for (int cell = 0; cell < 9; cell++) {
+            if (cell && cell % 3 == 0) board += '/';
+            board += (x >> cell & 1) ? 'X' : (o >> cell & 1) ? 'O' : '.';
+        }
+        uint64_t reached = counts.visits[POSITION_BASE3[x] + 2 * POSITION_BASE3[o]];
+        cout << board << " " << found[ranking[r]] << " " << reached << " " << 100.0 * found[ranking[r]] / reached
+             << "%\n";
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2 || argc > 4) {
+        cout << "Usage: " << argv[0] << " <log> [prefix-length 1-" << MAX_PREFIX << ", default 3] [threads]" << endl;
+        return 1;
+    }
+    int prefix_length = (argc > 2) ? parse_argument("prefix length", argv[2], 1, MAX_PREFIX) : 3;
+    unsigned threads = (argc > 3) ? parse_argument("thread count", argv[3], 1, MAX_THREADS)
+                                  : min(max(1U, thread::hardware_concurrency()), MAX_THREADS);
+
+    GameLogMap log;
+    string error;
+    if (!log.open(argv[1], error)) {
+        cout << error << endl;
+        return 1;
+    }
+
+    auto start = chrono::steady_clock::now();
+    vector<Counts> counts(threads, Counts(prefix_length));
+    vector<thread> workers;
+    for (unsigned t = 0; t < threads; t++) {
+        const GameRecord* begin = log.begin() + log.size() * t / threads;
+        const GameRecord* end = log.begin() + log.size() * (t + 1) / threads;
+        workers.push_back(thread(scan, begin, end, prefix_length, ref(counts[t])));
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    for (unsigned t = 1; t < threads; t++) {
+        counts[0].add(counts[t]);
+    }
+    const Counts& total = counts[0];
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    cout << "games: " << total.games << ", skipped: " << total.skipped << ", threads: " << threads
+         << ", seconds: " << seconds << ", games/sec: " << (uint64_t)(log.size() / seconds) << "\n";
+    print_top("opening", total.opening, opening_name, prefix_length);
+    print_top("prefix", total.prefix, prefix_name, prefix_length);
+    print_top("strategy", total.strategy, strategy_name, prefix_length);
+    print_blunders(total);
+    cout << flush;
+    return 0;
+}
@@ -0,0 +1,3 @@
+// The solved-position table generated by gentable at build time
+#include "board.h"
+#include "ttt_table.h"
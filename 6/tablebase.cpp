@@ -0,0 +1,110 @@
+#include "tablebase.h"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+
+Tablebase::Tablebase() : map_(nullptr), length_(0), entries_(nullptr) {
+    memset(&header_, 0, sizeof(header_));
+}
+
+Tablebase::~Tablebase() {
+    if (map_) {
+        munmap((void*)map_, length_);
+    }
+}
+
+bool Tablebase::open(const string& path, string& error) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        error = "Cannot open " + path + ": " + strerror(errno);
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) < 0 || (size_t)st.st_size < sizeof(TablebaseHeader)) {
+        error = "Not a tablebase: " + path;
+        close(fd);
+        return false;
+    }
+    void* map = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        error = "Cannot map " + path + ": " + strerror(errno);
+        return false;
+    }
+
+    TablebaseHeader header;
+    memcpy(&header, map, sizeof(header));
+    uint64_t positions = 1;
+    for (uint32_t i = 0; i < header.rows * header.cols && i < (uint32_t)TB_MAX_CELLS; i++) {
+        positions *= 3;
+    }
+    if (memcmp(header.magic, "TTTB", 4) != 0 || header.version != TB_VERSION ||
+        header.rows * header.cols > (uint32_t)TB_MAX_CELLS || header.positions != positions ||
+        (size_t)st.st_size != sizeof(header) + positions) {
+        error = "Not a tablebase: " + path;
+        munmap(map, st.st_size);
+        return false;
+    }
+
+    if (map_) {
+        munmap((void*)map_, length_);
+    }
+    header_ = header;
+    map_ = (const uint8_t*)map;
+    length_ = st.st_size;
+    entries_ = map_ + sizeof(header);
+    uint64_t power = 1;
+    for (int i = 0; i < TB_MAX_CELLS; i++) {
+        powers_[i] = power;
+        power *= 3;
+    }
+    return true;
+}
+
+bool Tablebase::covers(int rows, int cols, int k) const {
+    return map_ && rows == this->rows() && cols == this->cols() && k == this->k();
+}
+
+uint64_t Tablebase::index(const MnkBoard& board) const {
+    uint64_t index = 0;
+    for (int cell = 0; cell < board.size(); cell++) {
+        int stone = board.at(cell);
+        index += stone == 1 ? powers_[cell] : stone == -1 ? 2 * powers_[cell] : 0;
+    }
+    return index;
+}
+
+uint8_t Tablebase::probe(const MnkBoard& board) const {
+    return entries_[index(board)];
+}
+
+int Tablebase::best_move(const MnkBoard& board, int player, const int* order) const {
+    uint64_t base = index(board);
+    uint64_t digit = (player == 1) ? 1 : 2;
+    int best = -1;
+    int best_rank = 0;
+    for (int i = 0; i < board.size(); i++) {
+        int cell = order[i];
+        if (!board.is_free(cell)) continue;
+        // The child's entry is for the opponent: its loss is our win
+        uint8_t entry = entries_[base + digit * powers_[cell]];
+        int distance = tb_distance(entry);
+        int rank;
+        switch (tb_value(entry)) {
+            case TB_LOSS: rank = 3 * 64 - distance; break;
+            case TB_DRAW: rank = 2 * 64; break;
+            case TB_WIN: rank = 64 + distance; break;
+            default: rank = 0; break;
+        }
+        if (best < 0 || rank > best_rank) {
+            best = cell;
+            best_rank = rank;
+        }
+    }
+    return best;
+}
@@ -0,0 +1,72 @@
+#ifndef TABLEBASE_H
+#define TABLEBASE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "mnk.h"
+
+// On-disk tablebase of a small m,n,k board, written by gentb: a header,
+// then one byte per position. Positions are indexed in base 3 with cell i
+// as digit i (1 for X, 2 for O), as in the solved 3x3 table. Each byte
+// holds the value for the side to move in bits 0-1 and the number of plies
+// to the end of the game under best play in bits 2-7.
+enum TablebaseValue { TB_NONE, TB_LOSS, TB_DRAW, TB_WIN };   // TB_NONE: unreachable
+
+const int TB_MAX_CELLS = 16;    // 3^16 bytes is 43 MB
+const uint32_t TB_VERSION = 1;
+
+struct TablebaseHeader {
+    char magic[4];              // "TTTB"
+    uint32_t version;
+    uint32_t rows;
+    uint32_t cols;
+    uint32_t k;
+    uint32_t reserved;
+    uint64_t positions;         // 3^(rows * cols)
+};
+
+inline TablebaseValue tb_value(uint8_t entry) { return TablebaseValue(entry & 0x3); }
+inline int tb_distance(uint8_t entry) { return entry >> 2; }
+inline uint8_t tb_entry(TablebaseValue value, int distance) { return value | distance << 2; }
+
+// Read-only view of a tablebase file. The file is mapped rather than read,
+// so opening is instant, pages come in on first use, and every process
+// using the same file shares one copy in the page cache.
+class Tablebase {
+public:
+    Tablebase();
+    ~Tablebase();
+    Tablebase(const Tablebase&) = delete;
+    Tablebase& operator=(const Tablebase&) = delete;
+
+    // Function to map a tablebase file; on failure returns false and sets
+    // error to the message the CLI prints
+    bool open(const std::string& path, std::string& error);
+
+    int rows() const { return header_.rows; }
+    int cols() const { return header_.cols; }
+    int k() const { return header_.k; }
+
+    // Function to check that the tablebase was built for a board shape
+    bool covers(int rows, int cols, int k) const;
+
+    // Function to look up the entry of a position
+    uint8_t probe(const MnkBoard& board) const;
+
+    // Function to pick a best move for player (1 or -1) to move: the
+    // fastest win, else a draw, else the slowest loss. Ties go to the cell
+    // earliest in order.
+    int best_move(const MnkBoard& board, int player, const int* order) const;
+
+private:
+    uint64_t index(const MnkBoard& board) const;
+
+    TablebaseHeader header_;
+    const uint8_t* map_;
+    size_t length_;
+    const uint8_t* entries_;
+    uint64_t powers_[TB_MAX_CELLS];
+};
+
+#endif
@@ -0,0 +1,233 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include "board.h"
+#include "rng.h"
+#include "game.h"
+#include "policy.h"
+
+using namespace std;
+
+// Learns a move policy for the classic board by self-play, MENACE style:
+// every position holds a matchbox of beads per free cell, a move is drawn
+// with probability proportional to its beads, and after the game each move
+// gains beads if its side won or drew and loses one if it lost. Both sides
+// learn from the same boxes, since a position says whose turn it is.
+//
+// Threads play against the shared boxes but record their bead changes in
+// a private buffer, which is added to the boxes with atomic adds every
+// MERGE_GAMES games; nothing is ever locked. The policy written out plays,
+// in each position with X to move, the cell with the most beads.
+//
+//   ttttrain <file> [games] [threads] [seed]
+
+const int64_t INITIAL_BEADS = 8;
+const int64_t REWARD_WIN = 3;
+const int64_t REWARD_DRAW = 1;
+const int64_t REWARD_LOSS = -1;
+const uint64_t MERGE_GAMES = 4096;
+const unsigned MAX_THREADS = 256;   // each thread buffers about 1.4MB of experience
+
+// Beads gained or lost per (position, cell), on top of INITIAL_BEADS
+atomic<int64_t> beads[POSITIONS * 9];
+// Positions some game has been through, whether or not their beads moved
+atomic<bool> visited[POSITIONS];
+
+// Bead changes of one thread since its last merge, with the positions
+// they touch so a merge only walks those
+struct Experience {
+    vector<int64_t> delta;
+    vector<char> touched;
+    vector<int> positions;
+
+    Experience() : delta(POSITIONS * 9, 0), touched(POSITIONS, 0) {
+    }
+
+    void add(int slot, int64_t reward) {
+        int position = slot / 9;
+        if (!touched[position]) {
+            touched[position] = 1;
+            positions.push_back(position);
+        }
+        delta[slot] += reward;
+    }
+
+    void merge() {
+        for (int position : positions) {
+            for (int slot = position * 9; slot < position * 9 + 9; slot++) {
+                if (delta[slot]) {
+                    beads[slot].fetch_add(delta[slot], memory_order_relaxed);
+                    delta[slot] = 0;
+                }
+            }
+            touched[position] = 0;
+            visited[position].store(true, memory_order_relaxed);
+        }
+        positions.clear();
+    }
+};
+
+// Function to draw a cell for the side to move in proportion to its beads
+static int draw_cell(int position, uint16_t free_cells, Rng& rng) {
+    int cells[9];
+    int64_t weights[9];
+    int n = 0;
+    uint64_t total = 0;
+    for (; free_cells; free_cells &= free_cells - 1) {
+        int cell = __builtin_ctz(free_cells);
+        int64_t weight = INITIAL_BEADS + beads[position * 9 + cell].load(memory_order_relaxed);
+        cells[n] = cell;
+        weights[n] = weight < 1 ? 1 : weight;
+        total += weights[n];
+        n++;
+    }
+    uint64_t pick = rng.next() % total;
+    int i = 0;
+    while (pick >= (uint64_t)weights[i]) {
+        pick -= weights[i];
+        i++;
+    }
+    return cells[i];
+}
+
+// Function run by each training thread
+static void train_worker(uint64_t games, uint64_t seed) {
+    Rng rng = {seed};
+    Experience experience;
+    int path[9];
+    for (uint64_t g = 0; g < games; g++) {
+        uint16_t x = 0, o = 0;
+        int plies = 0;
+        Status status = STATUS_ONGOING;
+        while (status == STATUS_ONGOING) {
+            int position = POSITION_BASE3[x] + 2 * POSITION_BASE3[o];
+            int cell = draw_cell(position, FULL_BOARD & ~(x | o), rng);
+            path[plies] = position * 9 + cell;
+            if (plies % 2 == 0) {
+                x |= 1 << cell;
+            } else {
+                o |= 1 << cell;
+            }
+            plies++;
+            status = entry_status(lookup(x, o));
+        }
+
+        for (int p = 0; p < plies; p++) {
+            Status won = (p % 2 == 0) ? STATUS_X_WINS : STATUS_O_WINS;
+            experience.add(path[p], status == STATUS_DRAW ? REWARD_DRAW : status == won ? REWARD_WIN : REWARD_LOSS);
+        }
+        if ((g + 1) % MERGE_GAMES == 0) {
+            experience.merge();
+        }
+    }
+    experience.merge();
+}
+
+// Function to pick X's move, the free cell with the most beads, in every
+// position training went through
+static void build_policy(vector<uint8_t>& moves) {
+    moves.assign(POSITIONS, POLICY_NONE);
+    for (int x = 0; x < 512; x++) {
+        for (int o = 0; o < 512; o++) {
+            if ((x & o) || __builtin_popcount(x) != __builtin_popcount(o)) continue;
+            if (entry_status(lookup(x, o)) != STATUS_ONGOING) continue;
+            int position = POSITION_BASE3[x] + 2 * POSITION_BASE3[o];
+            if (!visited[position].load(memory_order_relaxed)) continue;
+            int best = -1;
+            int64_t most = 0;
+            for (uint16_t free_cells = FULL_BOARD & ~(x | o); free_cells; free_cells &= free_cells - 1) {
+                int cell = __builtin_ctz(free_cells);
+                int64_t count = INITIAL_BEADS + beads[position * 9 + cell].load(memory_order_relaxed);
+                if (best < 0 || count > most) {
+                    best = cell;
+                    most = count;
+                }
+            }
+            moves[position] = best;
+        }
+    }
+}
+
+// Function to count the games a policy loses against every possible
+// sequence of replies; where it has no move, X takes the lowest free cell
+static void count_losses(const vector<uint8_t>& moves, uint16_t x, uint16_t o, uint64_t& games, uint64_t& losses) {
+    int position = POSITION_BASE3[x] + 2 * POSITION_BASE3[o];
+    int cell = moves[position] != POLICY_NONE ? moves[position] : __builtin_ctz(FULL_BOARD & ~(x | o));
+    x |= 1 << cell;
+    if (entry_status(lookup(x, o)) != STATUS_ONGOING) {
+        games++;
+        return;
+    }
+    for (uint16_t replies = FULL_BOARD & ~(x | o); replies; replies &= replies - 1) {
+        uint16_t next = o | (1 << __builtin_ctz(replies));
+        Status status = entry_status(lookup(x, next));
+        if (status == STATUS_ONGOING) {
+            count_losses(moves, x, next, games, losses);
+        } else {
+            games++;
+            losses += (status == STATUS_O_WINS);
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2 || argc > 5) {
+        cout << "Usage: " << argv[0] << " <file> [games] [threads] [seed]" << endl;
+        return 1;
+    }
+    uint64_t games = (argc > 2) ? parse_argument("game count", argv[2], 0, UINT64_MAX) : 10000000;
+    unsigned threads = (argc > 3) ? parse_argument("thread count", argv[3], 1, MAX_THREADS)
+                                  : min(max(1U, thread::hardware_concurrency()), MAX_THREADS);
+    uint64_t seed = (argc > 4) ? parse_argument("seed", argv[4], 0, UINT64_MAX) : 1;
+
+    auto start = chrono::steady_clock::now();
+    vector<thread> workers;
+    for (unsigned t = 0; t < threads; t++) {
+        uint64_t share = games / threads + (t < games % threads ? 1 : 0);
+        workers.push_back(thread(train_worker, share, seed + t * 0x632BE59BD9B4E019ULL));
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    vector<uint8_t> moves;
+    build_policy(moves);
+    PolicyHeader header;
+    memcpy(header.magic, "TTTP", 4);
+    header.version = POLICY_VERSION;
+    header.positions = POSITIONS;
+    header.reserved = 0;
+    ofstream out(argv[1], ios::binary);
+    out.write((const char*)&header, sizeof(header));
+    out.write((const char*)moves.data(), moves.size());
+    if (!out) {
+        cout << "Cannot write " << argv[1] << endl;
+        return 1;
+    }
+
+    uint64_t learned = 0, optimal = 0;
+    for (int x = 0; x < 512; x++) {
+        for (int o = 0; o < 512; o++) {
+            if (x & o) continue;
+            int position = POSITION_BASE3[x] + 2 * POSITION_BASE3[o];
+            if (moves[position] == POLICY_NONE) continue;
+            learned++;
+            optimal += (entry_moves(lookup(x, o)) >> moves[position]) & 1;
+        }
+    }
+    uint64_t lines = 0, losses = 0;
+    count_losses(moves, 0, 0, lines, losses);
+
+    cout << "games: " << games << ", threads: " << threads << ", seconds: " << seconds
+         << ", games/sec: " << (uint64_t)(games / seconds) << endl;
+    cout << "positions: " << learned << ", optimal moves: " << optimal << ", lost lines: " << losses << " of "
+         << lines << endl;
+    return 0;
+}
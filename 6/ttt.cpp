@@ -1,189 +1,961 @@
-#include <iostream>
-#include <vector>
-#include <limits>
-#include <unordered_map>
+#include <cstdio>
+#include <cinttypes>
+#include <cctype>
+#include <climits>
+#include <cstdint>
+#include <chrono>
+#include <thread>
+#include <fstream>
+#include <getopt.h>
+#include <unistd.h>
+#include <cerrno>
+#include "board.h"
+#include "batch.h"
+#include "engine.h"
+#include "mcts.h"
+#include "search.h"
+#include "tablebase.h"
+#include "ultimate.h"
+#include "qubic.h"
+#include "game.h"
+#include "gamelog.h"
+#include "spectate.h"
+#include "analyze.h"
+#include "latency.h"
+#include "selfplay.h"
+#include "protocol.h"
+#include "session.h"
+#include "server.h"
 
 using namespace std;
-// Function to check the board for a win, lose, or draw condition
-void check_board(const vector<vector<int>>& board) {
-    // Check rows and columns for win/lose condition
-    for (int i = 0; i < 3; i++) {
-        if (board[i][0] == board[i][1] && board[i][1] == board[i][2]) {
-            if (board[i][0] != 0) {
-                cout << (board[i][0] == 1 ? "I WIN" : "I LOSE") << endl;
-                cout << "good game" << endl;
-                exit(0);
+
+// Output of an interactive game is collected here and written with a
+// single write() per frame, i.e. every time the game waits for input
+string frame;
+
+// Function to write out the pending frame
+void flush_frame() {
+    LatencyTimer timer(PROBE_FLUSH);
+    size_t done = 0;
+    while (done < frame.length()) {
+        ssize_t n = write(STDOUT_FILENO, frame.data() + done, frame.length() - done);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        done += n;
+    }
+    frame.clear();
+}
+
+// Function to benchmark the perfect-play engine on self-play games, once
+// with the transposition table cleared before every game and once warm,
+// then the solved-table lookup that replaces the search in play
+void run_benchmark(const Strategy& strategy) {
+    Negamax* engine = new Negamax();
+    const char* labels[2] = {"cold", "warm"};
+    const int games[2] = {200, 20000};
+    for (int pass = 0; pass < 2; pass++) {
+        uint64_t nodes = 0;
+        long moves = 0;
+        engine->clear();
+        auto start = chrono::steady_clock::now();
+        for (int g = 0; g < games[pass]; g++) {
+            if (pass == 0) engine->clear();
+            uint16_t me = 0, opp = 0;
+            while (!has_line(opp) && (me | opp) != FULL_BOARD) {
+                int cell = engine->best_move(me, opp, strategy.order(), nodes);
+                uint16_t next = me | (1 << cell);
+                me = opp;
+                opp = next;
+                moves++;
             }
         }
-        if (board[0][i] == board[1][i] && board[1][i] == board[2][i]) {
-            if (board[0][i] != 0) {
-                cout << (board[0][i] == 1 ? "WIN" : "LOSE") << endl;
-                cout << "gg" << endl;
-                exit(0);
-            }
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        printf("%s: %d games, %ld moves, %" PRIu64 " nodes, %" PRIu64 " nodes/sec, %g us/move\n", labels[pass],
+               games[pass], moves, nodes, (uint64_t)(nodes / seconds), seconds * 1e6 / moves);
+    }
+    delete engine;
+
+    const int table_games = 1000000;
+    long moves = 0;
+    uint64_t checksum = 0;
+    auto start = chrono::steady_clock::now();
+    for (int g = 0; g < table_games; g++) {
+        // Vary the opening so the lookups are not all the same game
+        uint16_t me = 1 << (g % 9), opp = 0;
+        while (!has_line(me) && (me | opp) != FULL_BOARD) {
+            uint16_t entry = (__builtin_popcount(me | opp) & 1) ? lookup(me, opp) : lookup(opp, me);
+            int cell = strategy.first_of(entry_moves(entry));
+            checksum += cell;
+            uint16_t next = opp | (1 << cell);
+            opp = me;
+            me = next;
+            moves++;
         }
     }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    printf("table: %d games, %ld moves, %g ns/move (checksum %" PRIu64 ")\n", table_games, moves,
+           seconds * 1e9 / moves, checksum);
+}
+
+// Function to measure MCTS playouts per second from the empty board, on
+// one thread and then on all of them
+void run_mcts_benchmark(int rows, int cols, int k, const MctsLimits& limits) {
+    Mcts engine;
+    MnkBoard board(rows, cols, k);
+    unsigned counts[2] = {1, limits.threads};
+    for (int pass = 0; pass < (limits.threads > 1 ? 2 : 1); pass++) {
+        MctsLimits run = limits;
+        run.threads = counts[pass];
+        MctsStats stats;
+        int cell = engine.best_move(board, 1, run, stats);
+        double rate = stats.playouts / stats.seconds;
+        printf("%dx%d k=%d, threads: %u, playouts: %" PRIu64 ", seconds: %g, playouts/sec: %" PRIu64
+               ", per core: %" PRIu64 ", nodes: %" PRIu64 ", move: %d\n", rows, cols, k, run.threads, stats.playouts,
+               stats.seconds, (uint64_t)rate, (uint64_t)(rate / run.threads), stats.nodes, cell + 1);
+    }
+}
+
+// Function to create the alpha-beta engine, on a shared table when named
+LazySmp* make_search(const string& shared_table) {
+    LazySmp* engine = new LazySmp();
+    string error;
+    if (!shared_table.empty() && !engine->attach(shared_table, error)) {
+        printf("%s\n", error.c_str());
+        exit(1);
+    }
+    return engine;
+}
 
-    // Check diagonals for win/lose condition
-    if (board[0][0] == board[1][1] && board[1][1] == board[2][2]) {
-        if (board[0][0] != 0) {
-            cout << (board[0][0] == 1 ? "WIN" : "LOSE") << endl;
-            cout << "gg" << endl;
-            exit(0);
+// Function to measure the alpha-beta engine from the empty board: nodes and
+// depth within the same deadline on one thread and then on all of them
+// (with a shared table, which is left warm for the next run)
+void run_search_benchmark(int rows, int cols, int k, const SearchLimits& limits, const string& shared_table) {
+    LazySmp* engine = make_search(shared_table);
+    MnkBoard board(rows, cols, k);
+    unsigned counts[2] = {1, limits.threads};
+    for (int pass = 0; pass < (limits.threads > 1 ? 2 : 1); pass++) {
+        SearchLimits run = limits;
+        run.threads = counts[pass];
+        SearchStats stats;
+        if (shared_table.empty()) {
+            engine->clear();
         }
+        int cell = engine->best_move(board, 1, run, stats);
+        printf("%dx%d k=%d, threads: %u, nodes: %" PRIu64 ", seconds: %g, nodes/sec: %" PRIu64
+               ", depth: %d, move: %d\n", rows, cols, k, run.threads, stats.nodes, stats.seconds,
+               (uint64_t)(stats.nodes / stats.seconds), stats.depth, cell + 1);
     }
-    if (board[0][2] == board[1][1] && board[1][1] == board[2][0]) {
-        if (board[0][2] != 0) {
-            cout << (board[0][2] == 1 ? "WIN" : "LOSE") << endl;
-            cout << "gg" << endl;
-            exit(0);
+    delete engine;
+}
+
+// Function to measure MCTS on ultimate tic-tac-toe from the empty board
+void run_ultimate_benchmark(const MctsLimits& limits) {
+    Mcts engine;
+    UltimateBoard board;
+    unsigned counts[2] = {1, limits.threads};
+    for (int pass = 0; pass < (limits.threads > 1 ? 2 : 1); pass++) {
+        MctsLimits run = limits;
+        run.threads = counts[pass];
+        MctsStats stats;
+        int move = engine.best_move(board, 1, run, stats);
+        double rate = stats.playouts / stats.seconds;
+        printf("ultimate, threads: %u, playouts: %" PRIu64 ", seconds: %g, playouts/sec: %" PRIu64
+               ", per core: %" PRIu64 ", nodes: %" PRIu64 ", move: %d%d\n", run.threads, stats.playouts,
+               stats.seconds, (uint64_t)rate, (uint64_t)(rate / run.threads), stats.nodes, move / 9 + 1, move % 9 + 1);
+    }
+}
+
+// Function to measure the Qubic search from the empty board
+void run_qubic_benchmark(const QubicLimits& limits) {
+    QubicSearch engine;
+    QubicBoard board;
+    QubicStats stats;
+    int cell = engine.best_move(board, 1, limits, stats);
+    printf("qubic, nodes: %" PRIu64 ", seconds: %g, nodes/sec: %" PRIu64 ", depth: %d, move: %d%d%d\n", stats.nodes,
+           stats.seconds, (uint64_t)(stats.nodes / stats.seconds), stats.depth, cell / 16 + 1, cell / 4 % 4 + 1,
+           cell % 4 + 1);
+}
+
+// Function to compare the batch status kernels with one check per board,
+// on random positions from real games
+void run_batch_benchmark(size_t count, uint64_t seed) {
+    vector<uint16_t> x(count), o(count);
+    Rng rng = {seed};
+    for (size_t i = 0; i < count; i++) {
+        uint16_t me = 0, opp = 0;
+        int stones = rng.next() % 10;
+        for (int s = 0; s < stones && !has_line(opp) && (me | opp) != FULL_BOARD; s++) {
+            uint16_t next = me | (1 << random_cell(FULL_BOARD & ~(me | opp), rng));
+            me = opp;
+            opp = next;
         }
+        // After an even number of stones "me" is X
+        bool x_to_move = __builtin_popcount(me | opp) % 2 == 0;
+        x[i] = x_to_move ? me : opp;
+        o[i] = x_to_move ? opp : me;
     }
 
-    // Check for draw condition
-    bool isDraw = true;
-    for (const auto& row : board) {
-        for (int cell : row) {
-            if (cell == 0) {
-                isDraw = false;
-                break;
-            }
+    const int reps = max<size_t>(1, 100000000 / count);
+    vector<uint8_t> expected(count), status(count);
+    uint64_t checksum = 0;
+    auto start = chrono::steady_clock::now();
+    for (int r = 0; r < reps; r++) {
+        for (size_t i = 0; i < count; i++) {
+            expected[i] = entry_status(lookup(x[i], o[i]));
         }
-        if (!isDraw) break;
+        checksum += expected[r % count];
     }
-    if (isDraw) {
-        cout << "DRAW" << endl;
-        exit(0);
+    double table_seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    printf("table: %" PRIu64 " positions/sec\n", (uint64_t)(reps * count / table_seconds));
+
+    double scalar_seconds = 0;
+    for (int kernel = KERNEL_SCALAR; kernel <= KERNEL_AVX2; kernel++) {
+        if (!kernel_supported(BatchKernel(kernel))) {
+            printf("%s: not supported\n", kernel_name(BatchKernel(kernel)));
+            continue;
+        }
+        start = chrono::steady_clock::now();
+        for (int r = 0; r < reps; r++) {
+            evaluate_batch(x.data(), o.data(), status.data(), count, BatchKernel(kernel));
+            checksum += status[r % count];
+        }
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        if (kernel == KERNEL_SCALAR) {
+            scalar_seconds = seconds;
+        }
+        printf("%s: %" PRIu64 " positions/sec, %gx scalar%s\n", kernel_name(BatchKernel(kernel)),
+               (uint64_t)(reps * count / seconds), scalar_seconds / seconds, status == expected ? "" : ", MISMATCH");
     }
+    printf("positions: %zu, repetitions: %d, best: %s (checksum %" PRIu64 ")\n", count, reps,
+           kernel_name(best_kernel()), checksum);
 }
 
-int main(int argc, char* argv[]) {
-    if (argc != 2) {
-        cout << "not valid input" << endl;
+// Function to write the tournament ranking to a file and summarize it
+void report_tournament(const TournamentReport& report, const string& path, unsigned threads) {
+    ofstream out(path);
+    if (!out) {
+        printf("Cannot open %s\n", path.c_str());
         exit(1);
     }
+    out << "# rank strategy wins losses draws score";
+    if (report.symmetric) {
+        out << " (each line stands for its 8 symmetric strategies)";
+    }
+    out << "\n";
+    for (size_t r = 0; r < report.ranking.size(); r++) {
+        const Outcome& outcome = report.ranking[r].outcome;
+        out << r + 1 << " " << report.ranking[r].strategy << " " << outcome.wins << " " << outcome.losses
+            << " " << outcome.draws << " " << outcome.wins - outcome.losses << "\n";
+    }
 
-    string select = argv[1];
+    printf("strategies: %zu, threads: %u, seconds: %g\n", report.ranking.size(), threads, report.seconds);
+    if (!report.ranking.empty()) {
+        const TournamentEntry& best = report.ranking[0];
+        printf("best: %s (wins %g, losses %g, draws %g)\n", best.strategy.c_str(), best.outcome.wins,
+               best.outcome.losses, best.outcome.draws);
+    }
+}
 
-    // Validation: check that the input length is 9 and contains each digit 1-9 exactly once
-    if (select.length() != 9) {
-        cout << "Input must be exactly 9 characters long." << endl;
-        exit(1);
+// Input of an interactive game, read straight from stdin like the frame is
+// written, so a game never sets up iostreams
+char input[4096];
+size_t input_pos = 0, input_end = 0;
+
+// Function to look at the next input byte without taking it; -1 once input ends
+int peek_input() {
+    if (input_pos == input_end) {
+        ssize_t n;
+        do {
+            n = ::read(STDIN_FILENO, input, sizeof(input));
+        } while (n < 0 && errno == EINTR);
+        if (n <= 0) {
+            return -1;
+        }
+        input_pos = 0;
+        input_end = n;
     }
+    return (unsigned char)input[input_pos];
+}
 
-    unordered_map<char, int> digit_count;
-    for (char c : select) {
-        if (c < '1' || c > '9') {
-            cout << "Input must contain only digits from 1 to 9." << endl;
+// Function to read the human's next number. Returns 0 for anything that is
+// not a number from 1 to size, after discarding the rest of the line, and
+// exits when input ends. Numbers are whitespace separated and parsed as
+// "cin >> num" would.
+int read_move(int size) {
+    int num = 0;
+    bool read;
+    int c;
+    {
+        LatencyTimer timer(PROBE_INPUT_WAIT);
+        while ((c = peek_input()) != -1 && isspace(c)) {
+            input_pos++;
+        }
+        bool negative = (c == '-');
+        if (c == '+' || c == '-') {
+            input_pos++;
+            c = peek_input();
+        }
+        int digits = 0;
+        bool overflow = false;
+        for (; c >= '0' && c <= '9'; c = peek_input()) {
+            input_pos++;
+            digits++;
+            overflow = overflow || num > (INT_MAX - (c - '0')) / 10;
+            if (!overflow) {
+                num = num * 10 + (c - '0');
+            }
+        }
+        read = digits > 0 && !overflow;
+        num = negative ? -num : num;
+    }
+    if (!read) {
+        if (c == -1) {
+            flush_frame();
             exit(1);
         }
-        digit_count[c]++;
+        num = 0;
+    }
+    if (num < 1 || num > size) {
+        while (c != -1 && c != '\n') {
+            input_pos++;
+            c = peek_input();
+        }
+        if (c == '\n') {
+            input_pos++;
+        }
+        return 0;
     }
+    return num;
+}
 
-    for (char c = '1'; c <= '9'; c++) {
-        if (digit_count[c] != 1) {
-            cout << "Each digit from 1 to 9 must appear exactly once." << endl;
-            exit(1);
+// Function to play one game on stdin/stdout with the AI moving first
+void play_interactive(const Game& game, ProtocolMode mode, GameLogWriter* log, SpectatorRing* ring) {
+    Session session(game, mode, log, ring);
+    session.start(frame);
+    while (!session.finished()) {
+        flush_frame();
+        session.input(read_move(game.size()), frame);
+    }
+    flush_frame();
+    if (log) {
+        log->flush();
+    }
+    exit(0);
+}
+
+// Function to open the spectator ring named on the command line, if any.
+// Watching is a side show: a game whose ring cannot be opened is played
+// unpublished, with a warning.
+SpectatorRing* open_ring(const string& name) {
+    if (name.empty()) {
+        return nullptr;
+    }
+    SpectatorRing* ring = new SpectatorRing();
+    string error;
+    if (!ring->open(name, error)) {
+        fprintf(stderr, "%s; playing without spectators\n", error.c_str());
+        delete ring;
+        return nullptr;
+    }
+    return ring;
+}
+
+// Function to follow a spectator ring forever, one line per event:
+// "<game> start <rows>x<cols> <k>" or "<game> <X|O> <cell> <state>" with
+// the cell and state as in the text protocol
+void watch(const string& name) {
+    SpectatorReader reader;
+    string error;
+    if (!reader.open(name, error)) {
+        printf("%s\n", error.c_str());
+        exit(1);
+    }
+    static const char states[] = "-WLD";
+    uint64_t lost = 0;
+    SpectatorEvent event;
+    while (true) {
+        while (reader.next(event)) {
+            if (reader.lost() != lost) {
+                frame += "# lost " + to_string(reader.lost() - lost) + "\n";
+                lost = reader.lost();
+            }
+            frame += to_string(event.game);
+            if (event.kind == EVENT_START) {
+                frame += " start " + to_string(event.rows) + "x" + to_string(event.cols) + " " + to_string(event.k);
+            } else {
+                frame += (event.player == 1) ? " X " : " O ";
+                frame += to_string(event.cell + 1) + " " + states[event.result & 3];
+            }
+            frame += "\n";
         }
+        flush_frame();
+        usleep(1000);
     }
+}
 
-    vector<int> matrix(9);
-    vector<vector<int>> board(3, vector<int>(3, 0));
+// Function to print every game in a log, one line each
+void dump_log(const string& path) {
+    GameLogReader reader;
+    string error;
+    if (!reader.open(path, error)) {
+        printf("%s\n", error.c_str());
+        exit(1);
+    }
+    static const char* const RESULTS[] = {"ongoing", "win", "loss", "draw"};
+    GameRecord record;
+    while (reader.next(record)) {
+        int order[9];
+        unrank_permutation(record.strategy(), order);
+        string line = to_string(record.start) + " " + to_string(record.duration_ms) + "ms ";
+        for (int i = 0; i < 9; i++) line += char('1' + order[i]);
+        line += record.perfect() ? " perfect " : " strategy ";
+        line += RESULTS[record.result()];
+        line += " ";
+        for (int i = 0; i < record.moves(); i++) line += char('1' + record.move(i));
+        line += '\n';
+        fputs(line.c_str(), stdout);
+    }
+    fflush(stdout);
+}
 
-    for (int i = 0; i < 9; i++) {
-        matrix[i] = select[i] - '0';
+// Function to add the board and, once the game is over, its result to the
+// frame; returns true when the game is over
+bool show_ultimate(const UltimateBoard& board) {
+    frame += board.render();
+    if (!board.winner() && !board.full()) {
+        return false;
     }
+    frame += board.winner() == 1 ? "I WIN\n" : board.winner() == -1 ? "I LOSE\n" : "DRAW\n";
+    return true;
+}
 
-    for (size_t i = 0; i < matrix.size(); i++) {
-        cout << matrix.at(i) << " ";
+// Function to play ultimate tic-tac-toe on stdin/stdout, AI (X) first.
+// Moves are two digits: the board, then the cell, both numbered 1-9.
+void play_ultimate(const MctsLimits& limits) {
+    Mcts engine;
+    UltimateBoard board;
+    while (true) {
+        MctsStats stats;
+        int move = engine.best_move(board, 1, limits, stats);
+        board.play(move, 1);
+        frame += "AI move: board = " + to_string(move / 9 + 1) + ", cell = " + to_string(move % 9 + 1) + "\n";
+        if (show_ultimate(board)) {
+            break;
+        }
+        while (true) {
+            frame += board.forced() >= 0 ? "Your move in board " + to_string(board.forced() + 1) + " (<board><cell>): "
+                                         : string("Your move in any board (<board><cell>): ");
+            flush_frame();
+            int num = read_move(99);
+            move = (num / 10 - 1) * 9 + num % 10 - 1;
+            if (num >= 11 && num % 10 != 0 && board.is_legal(move)) {
+                break;
+            }
+            frame += "Invalid move. Try again.\n";
+        }
+        board.play(move, -1);
+        if (show_ultimate(board)) {
+            break;
+        }
     }
-    cout << endl;
+    flush_frame();
+    exit(0);
+}
 
-    bool turn = true; // true for AI, false for human
+// Function to add the Qubic board and, once the game is over, its result to
+// the frame; returns true when the game is over
+bool show_qubic(const QubicBoard& board, bool won, int player) {
+    frame += board.render();
+    if (!won && !board.full()) {
+        return false;
+    }
+    frame += !won ? "DRAW\n" : player == 1 ? "I WIN\n" : "I LOSE\n";
+    return true;
+}
 
-    for (int j = 0; j < 9; j++) {
-        if (turn) {
-//            bool moveMade = false;
-            for (int i = 0; i < 9; i++) {
-                int num = matrix.at(i) - 1; // Adjusting 1-9 to 0-8 for indexing
-//                if (num < 0 || num > 8) continue; // Ensure num is within valid range
+// Function to play 4x4x4 tic-tac-toe on stdin/stdout, AI (X) first. Moves
+// are three digits: layer, row and column, each numbered 1-4.
+void play_qubic(const QubicLimits& limits) {
+    QubicSearch engine;
+    QubicBoard board;
+    while (true) {
+        QubicStats stats;
+        int cell = engine.best_move(board, 1, limits, stats);
+        bool won = board.play(cell, 1);
+        frame += "AI move: " + to_string(cell / 16 + 1) + to_string(cell / 4 % 4 + 1) + to_string(cell % 4 + 1) + "\n";
+        if (show_qubic(board, won, 1)) {
+            break;
+        }
+        while (true) {
+            frame += "Your move (<layer><row><col>): ";
+            flush_frame();
+            int num = read_move(444);
+            int layer = num / 100 - 1, row = num / 10 % 10 - 1, col = num % 10 - 1;
+            cell = layer * 16 + row * 4 + col;
+            if (layer >= 0 && row >= 0 && row < 4 && col >= 0 && col < 4 && board.is_free(cell)) {
+                break;
+            }
+            frame += "Invalid move. Try again.\n";
+        }
+        won = board.play(cell, -1);
+        if (show_qubic(board, won, -1)) {
+            break;
+        }
+    }
+    flush_frame();
+    exit(0);
+}
 
-                int row = num / 3;
-                int col = num % 3;
+// Function to hand the AI's moves to the engine picked on the command line
+void choose_engine(Game& game, bool mcts, bool alphabeta, const string& tablebase, const string& policy,
+                   const string& shared_table, const MctsLimits& limits, const SearchLimits& search_limits) {
+    if (mcts) {
+        game.use_mcts(new Mcts(), limits);
+    } else if (alphabeta) {
+        game.use_search(make_search(shared_table), search_limits);
+    } else if (!tablebase.empty()) {
+        Tablebase* table = new Tablebase();
+        string error;
+        if (!table->open(tablebase, error)) {
+            printf("%s\n", error.c_str());
+            exit(1);
+        }
+        if (!table->covers(game.rows(), game.cols(), game.k())) {
+            printf("The tablebase is for %dx%d k=%d boards.\n", table->rows(), table->cols(), table->k());
+            exit(1);
+        }
+        game.use_tablebase(table);
+    } else if (!policy.empty()) {
+        Policy* learned = new Policy();
+        string error;
+        if (!learned->open(policy, error)) {
+            printf("%s\n", error.c_str());
+            exit(1);
+        }
+        game.use_policy(learned);
+    }
+}
 
-                // Debugging: Print AI move information
-                cout << "AI move: i = " << i << ", num = " << num << ", row = " << row << ", col = " << col << endl;
+// Command lines printed by the usage message, after the program name
+static const char* const USAGE[] = {
+    "[--perfect] [--bench] [--simulate <games> [--opponent random|perfect|scripted:<order>] [--threads <n>]"
+    " [--seed <n>]] [--protocol[=text|binary]] <strategy>",
+    "--tournament <file> [--opponent all|random|perfect|scripted:<order>] [--threads <n>]",
+    "--size <rows>x<cols> [--k <n>] <cell,cell,...>",
+    "--serve TCPS<port>|UDSSS<path> [--perfect] [--protocol[=text|binary]] [--size <rows>x<cols> [--k <n>]] <strategy>",
+    "--mcts [--move-time <ms>] [--iterations <n>] [--threads <n>] [--bench] [--size <rows>x<cols> [--k <n>]] <strategy>",
+    "--alphabeta [--move-time <ms>] [--depth <n>] [--threads <n>] [--shared-table <name>] [--bench]"
+    " [--size <rows>x<cols> [--k <n>]] <strategy>",
+    "--tablebase <file> [--size <rows>x<cols> [--k <n>]] <strategy>",
+    "--ultimate [--move-time <ms>] [--iterations <n>] [--threads <n>] [--bench]",
+    "--qubic [--move-time <ms>] [--depth <n>] [--bench]",
+    "--batch <positions> [--seed <n>]",
+    "--log <file> [--perfect] [--serve TCPS<port>|UDSSS<path>] <strategy>",
+    "--dump-log <file>",
+    "--analyze[=text|binary] [--threads <n>]",
+    "--watch <ring>",
+    "--policy <file> [--serve TCPS<port>|UDSSS<path>] [<strategy>]",
+};
 
-                if (board[row][col] == 0) {
-                    board[row][col] = 1;
-                    turn = false;
-//                    moveMade = true;
-                    break;
-                }
+// Most threads any option may ask for
+const uint64_t MAX_THREADS = 1024;
+
+// Function to print the usage message and exit
+void usage(const char* program) {
+    printf("Usage: %s %s\n", program, USAGE[0]);
+    for (size_t line = 1; line < sizeof(USAGE) / sizeof(USAGE[0]); line++) {
+        printf("       %s %s\n", program, USAGE[line]);
+    }
+    printf("Any game also takes --latency[=<file>]: per-move timings, reported at exit and on SIGUSR1.\n"
+           "Any game also takes --spectate <ring>: every move is published to the ring for --watch.\n");
+    exit(1);
+}
+
+// Function to parse an option's argument, all of it, as a decimal number
+// from low to high; anything else prints the usage and exits
+uint64_t parse_number(const char* text, uint64_t low, uint64_t high, const char* program) {
+    uint64_t value;
+    if (!parse_decimal(text, low, high, value)) {
+        printf("Invalid number: %s (expected %" PRIu64 "-%" PRIu64 ")\n", text, low, high);
+        usage(program);
+    }
+    return value;
+}
+
+int main(int argc, char* argv[]) {
+    bool perfect = false;
+    bool bench = false;
+    bool mcts = false;
+    bool ultimate = false;
+    bool qubic = false;
+    bool alphabeta = false;
+    int depth = 0;
+    string tablebase;
+    string shared_table;
+    uint64_t batch = 0;
+    MctsLimits limits = {0, 0, 0};
+    uint64_t simulate = 0;
+    string opponent;
+    string tournament;
+    unsigned threads = 0;           // until --threads: one per core, looked up below
+    uint64_t seed = 1;
+    int rows = 3, cols = 3, k = 3;
+    ProtocolMode protocol = PROTOCOL_NONE;
+    string serve;
+    string log_path;
+    string dump;
+    bool latency = false;
+    string latency_path;
+    string policy;
+    string spectate;
+    string watch_ring;
+    bool analyze = false;
+    AnalyzeFormat analyze_format = ANALYZE_TEXT;
+
+    static struct option long_options[] = {
+        {"perfect", no_argument, nullptr, 'p'},
+        {"bench", no_argument, nullptr, 'b'},
+        {"simulate", required_argument, nullptr, 'n'},
+        {"opponent", required_argument, nullptr, 'o'},
+        {"threads", required_argument, nullptr, 't'},
+        {"seed", required_argument, nullptr, 's'},
+        {"tournament", required_argument, nullptr, 'T'},
+        {"size", required_argument, nullptr, 'S'},
+        {"k", required_argument, nullptr, 'k'},
+        {"protocol", optional_argument, nullptr, 'P'},
+        {"serve", required_argument, nullptr, 'L'},
+        {"mcts", no_argument, nullptr, 'm'},
+        {"move-time", required_argument, nullptr, 'M'},
+        {"iterations", required_argument, nullptr, 'i'},
+        {"ultimate", no_argument, nullptr, 'u'},
+        {"qubic", no_argument, nullptr, 'q'},
+        {"batch", required_argument, nullptr, 'x'},
+        {"alphabeta", no_argument, nullptr, 'a'},
+        {"depth", required_argument, nullptr, 'd'},
+        {"tablebase", required_argument, nullptr, 'B'},
+        {"shared-table", required_argument, nullptr, 'H'},
+        {"log", required_argument, nullptr, 'l'},
+        {"dump-log", required_argument, nullptr, 'D'},
+        {"latency", optional_argument, nullptr, 'Y'},
+        {"policy", required_argument, nullptr, 'R'},
+        {"analyze", optional_argument, nullptr, 'A'},
+        {"spectate", required_argument, nullptr, 'V'},
+        {"watch", required_argument, nullptr, 'w'},
+        {nullptr, 0, nullptr, 0}
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "pbn:o:t:s:T:S:k:L:mM:i:uqad:B:H:x:l:D:R:V:w:", long_options, nullptr)) != -1) {
+        switch (opt) {
+            case 'p':
+                perfect = true;
+                break;
+            case 'b':
+                bench = true;
+                break;
+            case 'n':
+                simulate = parse_number(optarg, 1, UINT64_MAX, argv[0]);
+                break;
+            case 'o':
+                opponent = optarg;
+                break;
+            case 't':
+                threads = max<uint64_t>(1, parse_number(optarg, 0, MAX_THREADS, argv[0]));
+                break;
+            case 's':
+                seed = parse_number(optarg, 0, UINT64_MAX, argv[0]);
+                break;
+            case 'T':
+                tournament = optarg;
+                break;
+            case 'S': {
+                // <rows>x<cols>, or <n> for a square board
+                string size = optarg;
+                size_t x = size.find('x');
+                rows = parse_number(size.substr(0, x).c_str(), 1, 10000, argv[0]);
+                cols = (x == string::npos) ? rows : parse_number(size.substr(x + 1).c_str(), 1, 10000, argv[0]);
+                break;
             }
-//            if (!moveMade) {
-//                cout << "No valid moves for AI. Ending game." << endl;
-//                exit(1);
-//            }
-        } else {
-            int num = 0;
-            while (true) {
-                cout << "Enter your move (1-9): ";
-                if (!(cin >> num) || num < 1 || num > 9) {
-                    cout << "Invalid input. Please enter a number between 1 and 9." << endl;
-                    cin.clear();
-                    cin.ignore(numeric_limits<streamsize>::max(), '\n');
+            case 'k':
+                k = parse_number(optarg, 1, 10000, argv[0]);
+                break;
+            case 'P':
+                // --protocol or --protocol=text for lines, --protocol=binary for records
+                if (!optarg || string(optarg) == "text") {
+                    protocol = PROTOCOL_TEXT;
+                } else if (string(optarg) == "binary") {
+                    protocol = PROTOCOL_BINARY;
                 } else {
-                    int row = (num - 1) / 3;
-                    int col = (num - 1) % 3;
-
-                    // Debugging: Print human move information
-                    cout << "Human move: num = " << num << ", row = " << row+1 << ", col = " << col+1 << endl;
-
-                    if (board[row][col] != 0) {
-                        cout << "Invalid move. The cell is already occupied. Try again." << endl;
-                    } else {
-                        board[row][col] = -1;
-                        turn = true;
-                        break;
-                    }
+                    printf("Unknown protocol: %s\n", optarg);
+                    exit(1);
                 }
-            }
+                break;
+            case 'L':
+                serve = optarg;
+                break;
+            case 'm':
+                mcts = true;
+                break;
+            case 'M':
+                limits.milliseconds = parse_number(optarg, 0, UINT32_MAX, argv[0]);
+                break;
+            case 'i':
+                limits.iterations = parse_number(optarg, 0, UINT64_MAX, argv[0]);
+                break;
+            case 'u':
+                ultimate = true;
+                break;
+            case 'q':
+                qubic = true;
+                break;
+            case 'x':
+                batch = parse_number(optarg, 0, 1 << 30, argv[0]);
+                break;
+            case 'a':
+                alphabeta = true;
+                break;
+            case 'd':
+                depth = parse_number(optarg, 0, 1000, argv[0]);
+                break;
+            case 'B':
+                tablebase = optarg;
+                break;
+            case 'H':
+                shared_table = optarg;
+                break;
+            case 'l':
+                log_path = optarg;
+                break;
+            case 'D':
+                dump = optarg;
+                break;
+            case 'A':
+                // --analyze or --analyze=text for lines, --analyze=binary for records
+                analyze = true;
+                if (!optarg || string(optarg) == "text") {
+                    analyze_format = ANALYZE_TEXT;
+                } else if (string(optarg) == "binary") {
+                    analyze_format = ANALYZE_BINARY;
+                } else {
+                    printf("Unknown analyze format: %s\n", optarg);
+                    exit(1);
+                }
+                break;
+            case 'V':
+                spectate = optarg;
+                break;
+            case 'w':
+                watch_ring = optarg;
+                break;
+            case 'R':
+                policy = optarg;
+                break;
+            case 'Y':
+                // --latency reports to stderr, --latency=<file> to a file
+                latency = true;
+                latency_path = optarg ? optarg : "";
+                break;
+            default:
+                usage(argv[0]);
         }
+    }
+    // Benchmarks report a line at a time, so a long run shows its progress
+    // through a pipe; everything else keeps stdout fully buffered
+    if (bench || batch) {
+        setvbuf(stdout, nullptr, _IOLBF, 0);
+    }
+    // Counting the cores reads sysfs, which a plain game should not pay for
+    // on every connection
+    if (threads == 0) {
+        bool threaded = mcts || alphabeta || ultimate || simulate || !tournament.empty() || analyze;
+        threads = threaded ? max(1U, thread::hardware_concurrency()) : 1;
+    }
+    // The engines search for a second per move unless told otherwise
+    SearchLimits search_limits = {threads, depth, limits.milliseconds};
+    if (!depth && !limits.milliseconds) {
+        search_limits.milliseconds = 1000;
+    }
+    limits.threads = threads;
+    if (!limits.milliseconds && !limits.iterations) {
+        limits.milliseconds = 1000;
+    }
+    // The server plays every AI move inline on its one thread, so an engine
+    // that thinks for a whole time budget would stall every other connection
+    if (!serve.empty() && (mcts || alphabeta)) {
+        printf("--serve takes no --mcts or --alphabeta.\n");
+        exit(1);
+    }
+    if (!shared_table.empty() && !alphabeta) {
+        printf("--shared-table needs --alphabeta.\n");
+        exit(1);
+    }
+    if ((mcts + alphabeta + !tablebase.empty() + !policy.empty() + perfect > 1) ||
+        ((mcts || alphabeta || !tablebase.empty() || !policy.empty()) && simulate)) {
+        printf("--mcts, --alphabeta, --tablebase, --policy and --perfect are exclusive, and --simulate takes none"
+               " of them.\n");
+        exit(1);
+    }
+    if (!policy.empty() && (bench || rows != 3 || cols != 3 || k != 3)) {
+        printf("--policy needs the 3x3 board and takes no --bench.\n");
+        exit(1);
+    }
 
-        // Debugging: Print the board state after each move
-        cout << "Board state after move:" << endl;
-//        for (const auto& row : board) {
-//            for (int cell : row) {
-//                cout << cell << " ";
-//            }
-//            cout << endl;
-//        }
-//        cout << endl;
-            int i=1;
-            for(int row = 0; row < 3; row++){
-                std::cout << "--------------"<<std::endl;
-                std::cout << "| ";
-                for(int column = 0; column < 3; column++){
-                    if (board[row][column] == 1){
-                        std::cout << "X | ";
-                    }
-                    else if (board[row][column] == -1){
-                        std::cout << "O | ";
-                    }
-                    else if (board[row][column] == 0){
-                        std::cout <<i<< "  | ";
-                    }
-//                    std::cout << board[row][column] << " | ";
-                    i++;
-                }
-                std::cout << std::endl;
+    // Only classic games played by the strategy or the solved table are logged
+    if (!log_path.empty() && (mcts || alphabeta || !tablebase.empty() || !policy.empty() || simulate || bench ||
+                              ultimate || qubic || rows != 3 || cols != 3 || k != 3)) {
+        printf("--log needs a classic game with the strategy or --perfect AI.\n");
+        exit(1);
+    }
+
+    if (latency) {
+        string error;
+        if (!enable_latency(latency_path, error)) {
+            printf("%s\n", error.c_str());
+            exit(1);
+        }
+    }
+
+    if (batch) {
+        run_batch_benchmark(batch, seed);
+        return 0;
+    }
+
+    if (!dump.empty()) {
+        dump_log(dump);
+        return 0;
+    }
+
+    if (!watch_ring.empty()) {
+        watch(watch_ring);
+    }
+
+    if (analyze) {
+        run_analyze(STDIN_FILENO, STDOUT_FILENO, analyze_format, threads);
+        return 0;
+    }
+
+    if (!tournament.empty()) {
+        OpponentModel model;
+        if (!parse_opponent(opponent.empty() ? "all" : opponent, model)) {
+            printf("Unknown opponent: %s\n", opponent.c_str());
+            exit(1);
+        }
+        report_tournament(run_tournament(model, threads), tournament, threads);
+        return 0;
+    }
+
+    // Ultimate tic-tac-toe is always played by MCTS and takes no strategy
+    if (ultimate) {
+        if (optind != argc || perfect || simulate || !serve.empty() || protocol != PROTOCOL_NONE) {
+            printf("not valid input\n");
+            exit(1);
+        }
+        if (bench) {
+            run_ultimate_benchmark(limits);
+        } else {
+            play_ultimate(limits);
+        }
+        return 0;
+    }
+
+    // So is 4x4x4 tic-tac-toe, by its own alpha-beta search
+    if (qubic) {
+        if (optind != argc || ultimate || perfect || simulate || !serve.empty() || protocol != PROTOCOL_NONE) {
+            printf("not valid input\n");
+            exit(1);
+        }
+        QubicLimits qubic_limits = {depth, search_limits.milliseconds};
+        if (bench) {
+            run_qubic_benchmark(qubic_limits);
+        } else {
+            play_qubic(qubic_limits);
+        }
+        return 0;
+    }
+
+    // A policy stands in for the strategy, which then only breaks its gaps
+    if (optind != argc - 1 && !(optind == argc && !policy.empty())) {
+        printf("not valid input\n");
+        exit(1);
+    }
+
+    string select = (optind < argc) ? argv[optind] : "123456789";
+    Strategy strategy;
+    string error;
+
+    if (rows != 3 || cols != 3 || k != 3) {
+        if (rows < 1 || cols < 1 || rows * cols > 10000 || k < 1 || k > max(rows, cols)) {
+            printf("Invalid board size.\n");
+            exit(1);
+        }
+        if (perfect || (bench && !mcts && !alphabeta) || simulate) {
+            printf("--perfect, --bench and --simulate need the 3x3 board.\n");
+            exit(1);
+        }
+        if (!strategy.parse_mnk(select, rows * cols, error)) {
+            printf("%s\n", error.c_str());
+            exit(1);
+        }
+        if (bench) {
+            if (mcts) {
+                run_mcts_benchmark(rows, cols, k, limits);
+            } else {
+                run_search_benchmark(rows, cols, k, search_limits, shared_table);
             }
-            std::cout << "--------------"<<std::endl;
-        check_board(board);
+            return 0;
+        }
+        Game game(strategy, rows, cols, k);
+        choose_engine(game, mcts, alphabeta, tablebase, policy, shared_table, limits, search_limits);
+        if (!serve.empty()) {
+            return run_server(serve, game, protocol, nullptr, open_ring(spectate)) ? 0 : 1;
+        }
+        play_interactive(game, protocol, nullptr, open_ring(spectate));
     }
 
+    if (!strategy.parse_classic(select, error)) {
+        printf("%s\n", error.c_str());
+        exit(1);
+    }
 
+    if (simulate) {
+        OpponentModel model;
+        if (!parse_opponent(opponent.empty() ? "random" : opponent, model) || model.type == OPPONENT_ALL) {
+            printf("Unknown opponent: %s\n", opponent.c_str());
+            exit(1);
+        }
+        SimulationReport report = run_simulation(strategy, perfect, model, simulate, threads, seed);
+        printf("games: %" PRIu64 ", wins: %" PRIu64 ", losses: %" PRIu64 ", draws: %" PRIu64 "\n", simulate,
+               report.total.wins, report.total.losses, report.total.draws);
+        printf("threads: %u, seconds: %g, games/sec: %" PRIu64 "\n", threads, report.seconds,
+               (uint64_t)(simulate / report.seconds));
+        return 0;
+    }
+    if (bench) {
+        if (mcts) {
+            run_mcts_benchmark(rows, cols, k, limits);
+        } else if (alphabeta) {
+            run_search_benchmark(rows, cols, k, search_limits, shared_table);
+        } else {
+            run_benchmark(strategy);
+        }
+        return 0;
+    }
+
+    GameLogWriter* log = nullptr;
+    if (!log_path.empty()) {
+        log = new GameLogWriter();
+        if (!log->open(log_path, error)) {
+            printf("%s\n", error.c_str());
+            exit(1);
+        }
+    }
+
+    Game game(strategy, perfect ? AI_PERFECT : AI_STRATEGY);
+    choose_engine(game, mcts, alphabeta, tablebase, policy, shared_table, limits, search_limits);
+    if (!serve.empty()) {
+        return run_server(serve, game, protocol, log, open_ring(spectate)) ? 0 : 1;
+    }
+    play_interactive(game, protocol, log, open_ring(spectate));
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,1276 @@
+// Generated by gentable - do not edit.
+#ifndef TTT_TABLE_H
+#define TTT_TABLE_H
+
+#include <cstdint>
+
+const uint16_t POSITION_BASE3[512] = {
+    0, 1, 3, 4, 9, 10, 12, 13, 27, 28, 30, 31, 36, 37, 39, 40,
+    81, 82, 84, 85, 90, 91, 93, 94, 108, 109, 111, 112, 117, 118, 120, 121,
+    243, 244, 246, 247, 252, 253, 255, 256, 270, 271, 273, 274, 279, 280, 282, 283,
+    324, 325, 327, 328, 333, 334, 336, 337, 351, 352, 354, 355, 360, 361, 363, 364,
+    729, 730, 732, 733, 738, 739, 741, 742, 756, 757, 759, 760, 765, 766, 768, 769,
+    810, 811, 813, 814, 819, 820, 822, 823, 837, 838, 840, 841, 846, 847, 849, 850,
+    972, 973, 975, 976, 981, 982, 984, 985, 999, 1000, 1002, 1003, 1008, 1009, 1011, 1012,
+    1053, 1054, 1056, 1057, 1062, 1063, 1065, 1066, 1080, 1081, 1083, 1084, 1089, 1090, 1092, 1093,
+    2187, 2188, 2190, 2191, 2196, 2197, 2199, 2200, 2214, 2215, 2217, 2218, 2223, 2224, 2226, 2227,
+    2268, 2269, 2271, 2272, 2277, 2278, 2280, 2281, 2295, 2296, 2298, 2299, 2304, 2305, 2307, 2308,
+    2430, 2431, 2433, 2434, 2439, 2440, 2442, 2443, 2457, 2458, 2460, 2461, 2466, 2467, 2469, 2470,
+    2511, 2512, 2514, 2515, 2520, 2521, 2523, 2524, 2538, 2539, 2541, 2542, 2547, 2548, 2550, 2551,
+    2916, 2917, 2919, 2920, 2925, 2926, 2928, 2929, 2943, 2944, 2946, 2947, 2952, 2953, 2955, 2956,
+    2997, 2998, 3000, 3001, 3006, 3007, 3009, 3010, 3024, 3025, 3027, 3028, 3033, 3034, 3036, 3037,
+    3159, 3160, 3162, 3163, 3168, 3169, 3171, 3172, 3186, 3187, 3189, 3190, 3195, 3196, 3198, 3199,
+    3240, 3241, 3243, 3244, 3249, 3250, 3252, 3253, 3267, 3268, 3270, 3271, 3276, 3277, 3279, 3280,
+    6561, 6562, 6564, 6565, 6570, 6571, 6573, 6574, 6588, 6589, 6591, 6592, 6597, 6598, 6600, 6601,
+    6642, 6643, 6645, 6646, 6651, 6652, 6654, 6655, 6669, 6670, 6672, 6673, 6678, 6679, 6681, 6682,
+    6804, 6805, 6807, 6808, 6813, 6814, 6816, 6817, 6831, 6832, 6834, 6835, 6840, 6841, 6843, 6844,
+    6885, 6886, 6888, 6889, 6894, 6895, 6897, 6898, 6912, 6913, 6915, 6916, 6921, 6922, 6924, 6925,
+    7290, 7291, 7293, 7294, 7299, 7300, 7302, 7303, 7317, 7318, 7320, 7321, 7326, 7327, 7329, 7330,
+    7371, 7372, 7374, 7375, 7380, 7381, 7383, 7384, 7398, 7399, 7401, 7402, 7407, 7408, 7410, 7411,
+    7533, 7534, 7536, 7537, 7542, 7543, 7545, 7546, 7560, 7561, 7563, 7564, 7569, 7570, 7572, 7573,
+    7614, 7615, 7617, 7618, 7623, 7624, 7626, 7627, 7641, 7642, 7644, 7645, 7650, 7651, 7653, 7654,
+    8748, 8749, 8751, 8752, 8757, 8758, 8760, 8761, 8775, 8776, 8778, 8779, 8784, 8785, 8787, 8788,
+    8829, 8830, 8832, 8833, 8838, 8839, 8841, 8842, 8856, 8857, 8859, 8860, 8865, 8866, 8868, 8869,
+    8991, 8992, 8994, 8995, 9000, 9001, 9003, 9004, 9018, 9019, 9021, 9022, 9027, 9028, 9030, 9031,
+    9072, 9073, 9075, 9076, 9081, 9082, 9084, 9085, 9099, 9100, 9102, 9103, 9108, 9109, 9111, 9112,
+    9477, 9478, 9480, 9481, 9486, 9487, 9489, 9490, 9504, 9505, 9507, 9508, 9513, 9514, 9516, 9517,
+    9558, 9559, 9561, 9562, 9567, 9568, 9570, 9571, 9585, 9586, 9588, 9589, 9594, 9595, 9597, 9598,
+    9720, 9721, 9723, 9724, 9729, 9730, 9732, 9733, 9747, 9748, 9750, 9751, 9756, 9757, 9759, 9760,
+    9801, 9802, 9804, 9805, 9810, 9811, 9813, 9814, 9828, 9829, 9831, 9832, 9837, 9838, 9840, 9841,
+};
+
+const uint16_t SOLVED_TABLE[19683] = {
+    2559, 2064, 0, 2197, 0, 2392, 0, 4184, 0, 2064, 0, 4448, 0, 0, 4168, 4400,
+    2064, 0, 0, 4424, 0, 2416, 4384, 0, 0, 0, 0, 2161, 0, 2326, 0, 0,
+    2224, 4113, 64, 0, 0, 0, 2096, 0, 0, 0, 2064, 0, 4144, 4097, 64, 0,
+    4352, 0, 4112, 0, 4160, 0, 0, 4118, 0, 4113, 4, 0, 0, 0, 0, 4369,
+    2, 0, 4097, 0, 64, 0, 4368, 0, 0, 0, 0, 0, 4112, 0, 0, 0,
+    0, 2373, 0, 2542, 0, 0, 2176, 4461, 256, 0, 0, 0, 2112, 0, 0, 0,
+    64, 0, 4160, 2539, 2304, 0, 2176, 0, 4224, 0, 4352, 0, 0, 0, 2080, 0,
+    0, 0, 32, 0, 4128, 0, 0, 0, 0, 0, 0, 0, 0, 480, 2080, 0,
+    4128, 0, 0, 480, 4128, 480, 0, 4551, 256, 0, 128, 0, 4224, 0, 4352, 0,
+    64, 0, 4160, 0, 0, 4160, 4160, 480, 0, 0, 4352, 0, 4224, 480, 0, 0,
+    0, 0, 0, 2542, 0, 2413, 2052, 0, 0, 0, 0, 2539, 2050, 0, 2049, 0,
+    2304, 0, 2176, 0, 0, 0, 0, 0, 2112, 0, 0, 0, 0, 2503, 2112, 0,
+    2117, 0, 2304, 0, 4160, 0, 2243, 0, 2304, 0, 0, 4352, 2176, 4224, 0, 0,
+    4160, 0, 2112, 4160, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0,
+    0, 0, 4098, 0, 4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2332, 0, 4100, 0, 0, 4160, 4116, 2064, 0, 0, 0, 256, 0,
+    0, 0, 256, 0, 4352, 2131, 2072, 0, 2200, 0, 4112, 0, 4120, 0, 0, 0,
+    4112, 0, 0, 0, 4112, 0, 4112, 0, 0, 0, 0, 0, 0, 0, 0, 464,
+    4112, 0, 4112, 0, 0, 4112, 4112, 464, 0, 2519, 2308, 0, 2308, 0, 4160, 0,
+    4352, 0, 2304, 0, 4352, 0, 0, 4160, 4352, 2304, 0, 0, 2514, 0, 2257, 2448,
+    0, 0, 0, 0, 0, 0, 2056, 0, 0, 0, 8, 0, 4104, 0, 0, 0,
+    0, 0, 0, 0, 0, 456, 2056, 0, 4104, 0, 0, 456, 4104, 456, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 514, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 514, 0, 0, 0, 514, 0, 0, 2373, 0, 2112, 0, 0, 4160,
+    4356, 2304, 0, 0, 0, 4160, 0, 0, 0, 449, 0, 4416, 2243, 2304, 0, 2176,
+    0, 4224, 0, 4352, 0, 2503, 2438, 0, 2309, 0, 2304, 0, 2176, 0, 2304, 0,
+    4352, 0, 0, 4352, 4352, 4224, 0, 0, 2112, 0, 2112, 4160, 0, 0, 0, 0,
+    4551, 0, 256, 0, 0, 4352, 128, 4224, 0, 0, 0, 4352, 0, 0, 0, 4224,
+    0, 4352, 64, 4160, 0, 4160, 0, 448, 0, 4160, 0, 0, 4100, 0, 4100, 2052,
+    0, 0, 0, 0, 4352, 450, 0, 449, 0, 4352, 0, 4352, 0, 0, 0, 0,
+    0, 2112, 0, 0, 0, 0, 0, 4180, 0, 4116, 4100, 0, 0, 0, 0, 4115,
+    2, 0, 1, 0, 4112, 0, 4176, 0, 0, 0, 0, 0, 256, 0, 0, 0,
+    0, 2519, 2112, 0, 2113, 0, 2452, 0, 4160, 0, 2113, 0, 2514, 0, 0, 2256,
+    4160, 2112, 0, 0, 4160, 0, 4352, 4352, 0, 0, 0, 0, 0, 0, 0, 0,
+    4100, 0, 0, 0, 0, 0, 4098, 0, 4097, 512, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4551, 256, 0, 128, 0, 4224, 0, 4352, 0,
+    64, 0, 4160, 0, 0, 456, 4160, 456, 0, 0, 4352, 0, 4224, 4352, 0, 0,
+    0, 0, 2373, 0, 2438, 0, 0, 2176, 4161, 452, 0, 0, 0, 2112, 0, 0,
+    0, 2112, 0, 4160, 2304, 4352, 0, 4352, 0, 4224, 0, 4416, 0, 0, 4352, 0,
+    4224, 452, 0, 0, 0, 0, 4160, 450, 0, 449, 0, 4288, 0, 4416, 0, 0,
+    0, 0, 0, 4480, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0,
+    0, 0, 4098, 0, 4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4160, 0, 4097, 452, 0, 0, 0, 0, 4097, 450, 0, 2049,
+    0, 2304, 0, 4160, 0, 0, 0, 0, 0, 4160, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2064, 0, 4484, 0, 0, 2192, 4369,
+    8, 0, 0, 0, 16, 0, 0, 0, 2064, 0, 4112, 4353, 8, 0, 2448, 0,
+    4224, 0, 4104, 0, 0, 0, 4102, 0, 0, 0, 4097, 0, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 4112, 4097, 0, 2, 0, 0, 4352, 4097, 513, 0, 4496,
+    2064, 0, 2064, 0, 4240, 0, 4368, 0, 2064, 0, 4112, 0, 0, 4112, 4112, 4112,
+    0, 0, 4352, 0, 4224, 4128, 0, 0, 0, 0, 0, 0, 2052, 0, 0, 0,
+    4, 0, 4100, 0, 0, 0, 0, 0, 0, 0, 0, 519, 2305, 0, 2050, 0,
+    0, 2176, 4097, 424, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4098, 0, 0, 0, 4097, 0, 1024,
+    4, 0, 4100, 0, 0, 420, 4100, 420, 0, 0, 0, 519, 0, 0, 0, 519,
+    0, 0, 4480, 2304, 0, 2176, 0, 4224, 0, 4352, 0, 2479, 2056, 0, 2093, 0,
+    2304, 0, 4104, 0, 2218, 0, 4352, 0, 0, 4352, 2176, 4224, 0, 0, 4104, 0,
+    2345, 2056, 0, 0, 0, 0, 2049, 0, 2304, 0, 0, 4352, 4097, 513, 0, 0,
+    0, 4352, 0, 0, 0, 4224, 0, 416, 4097, 513, 0, 2049, 0, 2304, 0, 0,
+    0, 0, 2080, 0, 2080, 4128, 0, 0, 0, 0, 2080, 4128, 0, 4128, 0, 416,
+    0, 416, 0, 0, 0, 0, 0, 2080, 0, 0, 0, 0, 0, 0, 2052, 0,
+    0, 0, 2064, 0, 4100, 0, 0, 0, 0, 0, 0, 0, 0, 408, 2073, 0,
+    2050, 0, 0, 2192, 4097, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4100,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4098, 0, 0, 0, 4097,
+    0, 1024, 2308, 0, 4356, 0, 0, 404, 4356, 2320, 0, 0, 0, 402, 0, 0,
+    0, 401, 0, 4368, 2451, 2448, 0, 2448, 0, 4224, 0, 4352, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4098, 0, 0, 0, 4097, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2052, 0, 0, 0, 2052, 0, 4100, 0, 0, 0, 0,
+    0, 0, 0, 0, 519, 2435, 0, 2050, 0, 0, 2176, 2049, 2304, 0, 2438, 0,
+    4352, 0, 0, 4352, 2176, 4224, 0, 0, 0, 4352, 0, 0, 0, 4224, 0, 4352,
+    2435, 2056, 0, 2441, 0, 2304, 0, 4104, 0, 0, 0, 4352, 0, 0, 0, 4224,
+    0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 4480, 4097, 0, 386, 0, 0,
+    4352, 4097, 513, 0, 4352, 2438, 0, 2308, 0, 4352, 0, 2176, 0, 2304, 0, 4352,
+    0, 0, 4352, 4352, 4224, 0, 0, 2434, 0, 2433, 2432, 0, 0, 0, 0, 4369,
+    8, 0, 2064, 0, 4240, 0, 4104, 0, 2064, 0, 4112, 0, 0, 4112, 4112, 408,
+    0, 0, 4104, 0, 4352, 4352, 0, 0, 0, 0, 2049, 0, 2308, 0, 0, 4352,
+    4097, 513, 0, 0, 0, 2064, 0, 0, 0, 401, 0, 4112, 4097, 513, 0, 4352,
+    0, 2304, 0, 0, 0, 0, 4112, 0, 4112, 4112, 0, 0, 0, 0, 4112, 4112,
+    0, 4112, 0, 4112, 0, 4112, 0, 0, 0, 0, 0, 400, 0, 0, 0, 0,
+    4, 0, 4100, 0, 0, 396, 4100, 396, 0, 0, 0, 519, 0, 0, 0, 519,
+    0, 0, 4352, 4352, 0, 4352, 0, 4224, 0, 4360, 0, 0, 0, 4100, 0, 0,
+    0, 389, 0, 4100, 0, 0, 0, 0, 0, 0, 0, 0, 519, 4352, 0, 386,
+    0, 0, 4352, 4097, 513, 0, 4100, 390, 0, 389, 0, 4228, 0, 4356, 0, 519,
+    0, 0, 0, 0, 519, 0, 519, 0, 0, 4352, 0, 4224, 4352, 0, 0, 0,
+    0, 0, 4104, 0, 2056, 4104, 0, 0, 0, 0, 2056, 4104, 0, 4104, 0, 392,
+    0, 4104, 0, 0, 0, 0, 0, 4104, 0, 0, 0, 0, 4097, 513, 0, 2049,
+    0, 2304, 0, 0, 0, 2049, 0, 2304, 0, 0, 4352, 4097, 513, 0, 0, 0,
+    0, 4097, 513, 0, 0, 0, 0, 0, 0, 0, 0, 1026, 0, 0, 0, 0,
+    0, 1026, 0, 1026, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4358, 0, 4097, 4, 0, 0, 0, 0, 4353, 2, 0, 4097, 0,
+    8, 0, 4352, 0, 0, 0, 0, 0, 4112, 0, 0, 0, 0, 2452, 4480, 0,
+    4352, 0, 4112, 0, 4112, 0, 2352, 0, 4128, 0, 0, 4352, 4128, 4224, 0, 0,
+    4112, 0, 4112, 4112, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0,
+    0, 0, 4098, 0, 4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2479, 2304, 0, 2176, 0, 4224, 0, 4352, 0, 2305, 0, 2056, 0,
+    0, 4104, 4384, 2304, 0, 0, 4352, 0, 4224, 424, 0, 0, 0, 0, 2080, 0,
+    4128, 0, 0, 420, 4128, 420, 0, 0, 0, 2080, 0, 0, 0, 2080, 0, 4128,
+    4128, 418, 0, 417, 0, 4256, 0, 4384, 0, 0, 4352, 0, 4224, 420, 0, 0,
+    0, 0, 4097, 418, 0, 4097, 0, 1025, 0, 4352, 0, 0, 0, 0, 0, 4480,
+    0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 4098, 0,
+    4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2052, 0, 2052, 4100, 0, 0, 0, 0, 2435, 2050, 0, 2049, 0, 2304, 0, 2176,
+    0, 0, 0, 0, 0, 1031, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4352, 2304, 0, 4353, 0, 8, 0, 4368, 0, 4352, 0,
+    4352, 0, 0, 4104, 4352, 2304, 0, 0, 4112, 0, 4112, 4112, 0, 0, 0, 0,
+    4112, 0, 4112, 0, 0, 4112, 4112, 4112, 0, 0, 0, 402, 0, 0, 0, 401,
+    0, 4368, 4112, 4112, 0, 4112, 0, 4112, 0, 4112, 0, 0, 4356, 0, 4097, 4,
+    0, 0, 0, 0, 4352, 402, 0, 4097, 0, 1025, 0, 4352, 0, 0, 0, 0,
+    0, 4112, 0, 0, 0, 0, 2056, 0, 4104, 0, 0, 4104, 4104, 396, 0, 0,
+    0, 4104, 0, 0, 0, 393, 0, 4360, 4104, 394, 0, 393, 0, 4232, 0, 4360,
+    0, 0, 0, 514, 0, 0, 0, 514, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 514, 514, 0, 0, 0, 0, 514, 0, 514, 0, 2049, 2304, 0, 4097,
+    0, 1025, 0, 4352, 0, 4097, 0, 1025, 0, 0, 0, 4352, 2304, 0, 0, 4352,
+    0, 4224, 384, 0, 0, 0, 0, 0, 4100, 0, 4100, 4100, 0, 0, 0, 0,
+    4352, 394, 0, 393, 0, 4352, 0, 4352, 0, 0, 0, 0, 0, 1031, 0, 0,
+    0, 0, 4, 4100, 0, 4100, 0, 388, 0, 388, 0, 4352, 0, 4352, 0, 0,
+    4352, 4352, 4224, 0, 0, 1031, 0, 1031, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4100, 0, 0, 0, 0, 0, 4354, 0, 4353, 512, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0,
+    0, 0, 4098, 0, 4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2308, 0, 2452, 4100, 0, 0, 0, 0, 2451, 2050, 0, 2049,
+    0, 2448, 0, 2448, 0, 0, 0, 0, 0, 400, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4352, 0, 4224, 396, 0, 0,
+    0, 0, 4099, 394, 0, 393, 0, 4224, 0, 4352, 0, 0, 0, 0, 0, 4480,
+    0, 0, 0, 0, 2438, 4352, 0, 2176, 0, 4224, 0, 4352, 0, 2435, 0, 2434,
+    0, 0, 2176, 2433, 2304, 0, 0, 4352, 0, 4224, 4352, 0, 0, 0, 0, 0,
+    0, 0, 0, 4484, 0, 0, 0, 0, 0, 4354, 0, 4225, 512, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 4098,
+    0, 4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2386, 0, 4160, 0, 0,
+    4112, 2429, 2368, 0, 0, 0, 2112, 0, 0, 0, 2368, 0, 4416, 4352, 2304, 0,
+    4112, 0, 4112, 0, 4416, 0, 0, 0, 4100, 0, 0, 0, 2368, 0, 4100, 0,
+    0, 0, 0, 0, 0, 0, 0, 368, 4353, 0, 2, 0, 0, 4112, 4097, 64,
+    0, 4176, 2064, 0, 4112, 0, 4112, 0, 4352, 0, 2064, 0, 4160, 0, 0, 4160,
+    4416, 2320, 0, 0, 4368, 0, 4112, 4112, 0, 0, 0, 0, 0, 0, 2050, 0,
+    0, 0, 2373, 0, 2052, 0, 0, 0, 0, 0, 0, 0, 0, 2112, 2050, 0,
+    4098, 0, 0, 515, 2049, 2304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4100,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4098, 0, 0, 0, 4097,
+    0, 1024, 2, 0, 4098, 0, 0, 515, 4416, 2304, 0, 0, 0, 4160, 0, 0,
+    0, 2112, 0, 4160, 4098, 354, 0, 515, 0, 0, 0, 4352, 0, 2413, 2408, 0,
+    4461, 0, 256, 0, 4160, 0, 2408, 0, 4352, 0, 0, 4352, 4352, 2408, 0, 0,
+    4160, 0, 64, 4160, 0, 0, 0, 0, 2369, 0, 2304, 0, 0, 4352, 4160, 2112,
+    0, 0, 0, 4352, 0, 0, 0, 2368, 0, 4352, 4160, 4160, 0, 4160, 0, 352,
+    0, 4160, 0, 0, 2080, 0, 32, 4128, 0, 0, 0, 0, 2080, 4128, 0, 4128,
+    0, 352, 0, 2080, 0, 0, 0, 0, 0, 352, 0, 0, 0, 0, 0, 0,
+    4164, 0, 0, 0, 2368, 0, 4100, 0, 0, 0, 0, 0, 0, 0, 0, 256,
+    4097, 0, 2, 0, 0, 4112, 4097, 344, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4098, 0, 0,
+    0, 4097, 0, 1024, 2308, 0, 4160, 0, 0, 4160, 4352, 2304, 0, 0, 0, 4160,
+    0, 0, 0, 2304, 0, 4352, 2131, 2320, 0, 2064, 0, 4112, 0, 4352, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4098, 0, 0, 0, 4097, 0, 1024, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4160, 0, 0, 0, 4097, 0, 324, 0, 0,
+    0, 0, 0, 0, 0, 0, 4160, 2050, 0, 4098, 0, 0, 515, 2049, 2304, 0,
+    2372, 0, 4352, 0, 0, 4352, 4352, 2368, 0, 0, 0, 4352, 0, 0, 0, 2304,
+    0, 4352, 2112, 4160, 0, 4160, 0, 328, 0, 4160, 0, 0, 0, 4352, 0, 0,
+    0, 4101, 0, 324, 0, 0, 0, 0, 0, 0, 0, 0, 4352, 4160, 0, 322,
+    0, 0, 4416, 321, 4160, 0, 4352, 2308, 0, 4161, 0, 324, 0, 4352, 0, 2304,
+    0, 4352, 0, 0, 4416, 4352, 2304, 0, 0, 2112, 0, 2112, 4160, 0, 0, 0,
+    0, 4368, 2064, 0, 4112, 0, 4112, 0, 4416, 0, 2064, 0, 4176, 0, 0, 4112,
+    4160, 2128, 0, 0, 4352, 0, 4112, 4352, 0, 0, 0, 0, 2113, 0, 2326, 0,
+    0, 2064, 4160, 2112, 0, 0, 0, 2128, 0, 0, 0, 2112, 0, 4160, 4352, 4352,
+    0, 4352, 0, 4112, 0, 4160, 0, 0, 4112, 0, 4112, 4112, 0, 0, 0, 0,
+    4112, 4112, 0, 4112, 0, 4112, 0, 4112, 0, 0, 0, 0, 0, 4112, 0, 0,
+    0, 0, 2, 0, 4098, 0, 0, 515, 4416, 2304, 0, 0, 0, 330, 0, 0,
+    0, 2112, 0, 4160, 4098, 4352, 0, 515, 0, 0, 0, 4352, 0, 0, 0, 2050,
+    0, 0, 0, 4100, 0, 2052, 0, 0, 0, 0, 0, 0, 0, 0, 2112, 4352,
+    0, 4098, 0, 0, 515, 321, 4352, 0, 4098, 326, 0, 515, 0, 0, 0, 4352,
+    0, 323, 0, 4162, 0, 0, 515, 4160, 320, 0, 0, 4354, 0, 0, 515, 0,
+    0, 0, 0, 0, 2056, 0, 8, 4104, 0, 0, 0, 0, 2056, 4104, 0, 4104,
+    0, 328, 0, 2056, 0, 0, 0, 0, 0, 328, 0, 0, 0, 0, 4160, 2112,
+    0, 4356, 0, 2304, 0, 4160, 0, 2113, 0, 2304, 0, 0, 4352, 4160, 2112, 0,
+    0, 4160, 0, 321, 4416, 0, 0, 0, 0, 0, 0, 0, 0, 1026, 0, 0,
+    0, 0, 0, 1026, 0, 1026, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 256, 0, 0, 0, 2304, 0, 4352, 0, 0, 0,
+    0, 0, 0, 0, 0, 312, 4352, 0, 4352, 0, 0, 312, 4352, 312, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4098, 0, 0, 0, 4097, 0, 1024, 256, 0, 4352, 0, 0, 308,
+    4352, 2304, 0, 0, 0, 306, 0, 0, 0, 305, 0, 4368, 4352, 2304, 0, 305,
+    0, 4368, 0, 4352, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4098, 0, 0, 0, 4097, 0, 1024,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 294, 0, 0,
+    0, 293, 0, 4356, 0, 0, 0, 0, 0, 0, 0, 0, 519, 291, 0, 4354,
+    0, 0, 515, 4352, 2304, 0, 2304, 0, 4352, 0, 0, 4352, 4352, 300, 0, 0,
+    0, 4352, 0, 0, 0, 2304, 0, 4352, 4352, 298, 0, 4352, 0, 4352, 0, 4360,
+    0, 0, 0, 4352, 0, 0, 0, 293, 0, 4352, 0, 0, 0, 0, 0, 0,
+    0, 0, 4352, 291, 0, 4352, 0, 0, 4352, 4353, 513, 0, 4352, 4128, 0, 4128,
+    0, 4352, 0, 4352, 0, 4128, 0, 4352, 0, 0, 4384, 4352, 4128, 0, 0, 4352,
+    0, 4352, 4128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4100,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4098, 0, 0, 0, 4097,
+    0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256,
+    0, 0, 0, 2304, 0, 4352, 0, 0, 0, 0, 0, 0, 0, 0, 272, 2304,
+    0, 4352, 0, 0, 272, 4352, 2304, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4098, 0, 0, 0, 4097, 0, 1024, 0, 0, 4352, 0, 0, 0, 2304,
+    0, 4352, 0, 0, 0, 0, 0, 0, 0, 0, 4352, 2304, 0, 4352, 0, 0,
+    4352, 4352, 264, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4356, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4354, 0, 0, 0, 4097, 0, 1024, 2304,
+    0, 4352, 0, 0, 4352, 4352, 2304, 0, 0, 0, 4352, 0, 0, 0, 2304, 0,
+    4352, 4352, 2304, 0, 2304, 0, 4352, 0, 4352, 0, 4352, 0, 4352, 0, 0, 284,
+    4352, 284, 0, 0, 0, 282, 0, 0, 0, 281, 0, 4368, 4352, 4352, 0, 4352,
+    0, 4368, 0, 4360, 0, 0, 0, 4352, 0, 0, 0, 277, 0, 4352, 0, 0,
+    0, 0, 0, 0, 0, 0, 272, 4352, 0, 4352, 0, 0, 4352, 4353, 513, 0,
+    4352, 4112, 0, 4112, 0, 4368, 0, 4352, 0, 4112, 0, 4368, 0, 0, 4112, 4368,
+    4112, 0, 0, 4352, 0, 4368, 4368, 0, 0, 0, 0, 0, 0, 270, 0, 0,
+    0, 269, 0, 4356, 0, 0, 0, 0, 0, 0, 0, 0, 519, 4352, 0, 4354,
+    0, 0, 515, 4352, 4352, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4354, 0, 0, 0, 4353, 0,
+    1024, 263, 0, 4358, 0, 0, 515, 4356, 260, 0, 0, 0, 519, 0, 0, 0,
+    519, 0, 0, 4354, 4352, 0, 515, 0, 0, 0, 4352, 0, 4352, 4104, 0, 4104,
+    0, 4352, 0, 4360, 0, 4104, 0, 4352, 0, 0, 4360, 4352, 4104, 0, 0, 4360,
+    0, 4352, 4360, 0, 0, 0, 0, 263, 0, 4352, 0, 0, 4352, 4353, 513, 0,
+    0, 0, 4352, 0, 0, 0, 257, 0, 4352, 4353, 513, 0, 4352, 0, 4352, 0,
+    0, 0, 0, 1026, 0, 1026, 0, 0, 0, 0, 0, 1026, 0, 0, 0, 0,
+    1026, 0, 1026, 0, 0, 0, 0, 0, 1026, 0, 0, 0, 0, 2077, 2066, 0,
+    4112, 0, 4112, 0, 2364, 0, 2067, 0, 2056, 0, 0, 4104, 2361, 2352, 0, 0,
+    4112, 0, 4112, 4112, 0, 0, 0, 0, 2098, 0, 4112, 0, 0, 4112, 2101, 2352,
+    0, 0, 0, 2096, 0, 0, 0, 2352, 0, 4128, 4112, 4112, 0, 4112, 0, 4112,
+    0, 4112, 0, 0, 4114, 0, 4112, 308, 0, 0, 0, 0, 4097, 2, 0, 4097,
+    0, 1025, 0, 4352, 0, 0, 0, 0, 0, 4112, 0, 0, 0, 0, 2050, 0,
+    4098, 0, 0, 515, 2093, 2304, 0, 0, 0, 4104, 0, 0, 0, 2345, 0, 2056,
+    4098, 298, 0, 515, 0, 0, 0, 4352, 0, 0, 0, 294, 0, 0, 0, 2080,
+    0, 4128, 0, 0, 0, 0, 0, 0, 0, 0, 2080, 291, 0, 4130, 0, 0,
+    515, 4128, 288, 0, 4098, 294, 0, 515, 0, 0, 0, 4352, 0, 4097, 0, 1025,
+    0, 0, 0, 2049, 2304, 0, 0, 4354, 0, 0, 515, 0, 0, 0, 0, 0,
+    2052, 0, 4, 4100, 0, 0, 0, 0, 2345, 2050, 0, 4097, 0, 296, 0, 2344,
+    0, 0, 0, 0, 0, 1031, 0, 0, 0, 0, 2052, 4100, 0, 4100, 0, 292,
+    0, 2052, 0, 2339, 0, 2304, 0, 0, 4352, 2337, 2336, 0, 0, 1031, 0, 1031,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 4098,
+    0, 4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4097, 0, 8, 0, 0, 4104, 2077, 2320, 0, 0, 0, 4104, 0, 0, 0, 2304,
+    0, 4352, 4112, 4112, 0, 4112, 0, 4112, 0, 4112, 0, 0, 0, 4112, 0, 0,
+    0, 2064, 0, 4112, 0, 0, 0, 0, 0, 0, 0, 0, 272, 4112, 0, 4112,
+    0, 0, 4112, 4112, 4112, 0, 4097, 278, 0, 4097, 0, 1025, 0, 4352, 0, 4097,
+    0, 1025, 0, 0, 0, 4352, 2304, 0, 0, 4112, 0, 4112, 4112, 0, 0, 0,
+    0, 0, 0, 4104, 0, 0, 0, 2056, 0, 4104, 0, 0, 0, 0, 0, 0,
+    0, 0, 4104, 267, 0, 4106, 0, 0, 515, 4104, 264, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 514, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    514, 0, 0, 0, 514, 0, 0, 4097, 0, 1025, 0, 0, 0, 2049, 2304, 0,
+    0, 0, 0, 0, 0, 0, 4097, 0, 1025, 4098, 258, 0, 515, 0, 0, 0,
+    4352, 0, 2052, 4100, 0, 4100, 0, 268, 0, 2052, 0, 2304, 0, 4352, 0, 0,
+    4360, 4352, 2304, 0, 0, 1031, 0, 1031, 0, 0, 0, 0, 0, 4100, 0, 262,
+    0, 0, 4356, 2052, 4100, 0, 0, 0, 4352, 0, 0, 0, 2304, 0, 4352, 1031,
+    0, 0, 0, 0, 1031, 0, 1031, 0, 0, 4100, 0, 261, 4100, 0, 0, 0,
+    0, 4352, 258, 0, 4097, 0, 1025, 0, 4352, 0, 0, 0, 0, 0, 1031, 0,
+    0, 0, 0, 0, 4114, 0, 4112, 284, 0, 0, 0, 0, 4098, 2050, 0, 281,
+    0, 4112, 0, 2328, 0, 0, 0, 0, 0, 4112, 0, 0, 0, 0, 2326, 4100,
+    0, 2064, 0, 4112, 0, 2324, 0, 2067, 0, 2322, 0, 0, 2064, 2321, 2320, 0,
+    0, 274, 0, 4112, 4368, 0, 0, 0, 0, 0, 0, 0, 0, 4116, 0, 0,
+    0, 0, 0, 4098, 0, 4113, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4098, 270, 0, 515, 0, 0, 0, 4352, 0, 2050, 0, 4098,
+    0, 0, 515, 2313, 2304, 0, 0, 4354, 0, 0, 515, 0, 0, 0, 0, 2050,
+    0, 4098, 0, 0, 515, 2309, 2304, 0, 0, 0, 2050, 0, 0, 0, 2305, 0,
+    2304, 4098, 4352, 0, 515, 0, 0, 0, 4352, 0, 0, 4354, 0, 0, 515, 0,
+    0, 0, 0, 4098, 258, 0, 515, 0, 0, 0, 4352, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 4098,
+    0, 4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2052, 0, 2052, 4100, 0, 0, 0, 0, 2307, 2050, 0, 2049, 0, 2304, 0,
+    2304, 0, 0, 0, 0, 0, 1031, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4180, 0, 2429, 2052, 0, 0, 0, 0, 4369,
+    2, 0, 2049, 0, 2368, 0, 4112, 0, 0, 0, 0, 0, 2368, 0, 0, 0,
+    0, 4176, 4160, 0, 2053, 0, 2416, 0, 4160, 0, 2064, 0, 4144, 0, 0, 4352,
+    4112, 4112, 0, 0, 4160, 0, 2416, 4160, 0, 0, 0, 0, 0, 0, 0, 0,
+    4100, 0, 0, 0, 0, 0, 4098, 0, 4097, 512, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4461, 256, 0, 2373, 0, 2408, 0, 4352, 0,
+    64, 0, 4160, 0, 0, 4160, 4160, 360, 0, 0, 4352, 0, 2408, 4352, 0, 0,
+    0, 0, 32, 0, 4128, 0, 0, 2080, 4128, 356, 0, 0, 0, 354, 0, 0,
+    0, 353, 0, 4192, 4128, 354, 0, 2080, 0, 4128, 0, 4448, 0, 0, 4352, 0,
+    4101, 356, 0, 0, 0, 0, 4160, 354, 0, 353, 0, 4160, 0, 4416, 0, 0,
+    0, 0, 0, 4352, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0,
+    0, 0, 4098, 0, 4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4160, 0, 4097, 356, 0, 0, 0, 0, 2050, 4098, 0, 2049,
+    0, 2304, 0, 1027, 0, 0, 0, 0, 0, 4160, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4368, 2064, 0, 2053, 0, 2392, 0,
+    4112, 0, 4352, 0, 4352, 0, 0, 4352, 4352, 4112, 0, 0, 4120, 0, 2392, 4160,
+    0, 0, 0, 0, 4112, 0, 4112, 0, 0, 2064, 4112, 4112, 0, 0, 0, 338,
+    0, 0, 0, 4112, 0, 4368, 4112, 338, 0, 2064, 0, 4112, 0, 4176, 0, 0,
+    4356, 0, 4100, 2052, 0, 0, 0, 0, 4352, 338, 0, 337, 0, 4352, 0, 4352,
+    0, 0, 0, 0, 0, 2384, 0, 0, 0, 0, 8, 0, 4104, 0, 0, 2056,
+    4104, 332, 0, 0, 0, 330, 0, 0, 0, 329, 0, 4424, 4104, 330, 0, 2056,
+    0, 4104, 0, 4360, 0, 0, 0, 514, 0, 0, 0, 514, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 514, 514, 0, 0, 0, 0, 514, 0, 514, 0,
+    4356, 2304, 0, 4160, 0, 2112, 0, 4352, 0, 323, 0, 4416, 0, 0, 4160, 4416,
+    320, 0, 0, 4352, 0, 2369, 2304, 0, 0, 0, 0, 0, 2050, 0, 4100, 2052,
+    0, 0, 0, 0, 4352, 4098, 0, 329, 0, 4352, 0, 1027, 0, 0, 0, 0,
+    0, 2112, 0, 0, 0, 0, 2, 4098, 0, 4416, 0, 2304, 0, 1027, 0, 4098,
+    0, 4352, 0, 0, 4352, 1027, 0, 0, 0, 4160, 0, 2112, 4160, 0, 0, 0,
+    0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 4354, 0, 4353, 512, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4100, 0, 0, 0, 0, 0, 4098, 0, 4097, 512, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4160, 0, 4097, 340, 0, 0, 0, 0,
+    4161, 338, 0, 2049, 0, 2384, 0, 4160, 0, 0, 0, 0, 0, 4160, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4352, 0,
+    4101, 332, 0, 0, 0, 0, 4160, 330, 0, 329, 0, 4160, 0, 4416, 0, 0,
+    0, 0, 0, 4352, 0, 0, 0, 0, 4161, 326, 0, 4352, 0, 2372, 0, 4416,
+    0, 2112, 0, 4160, 0, 0, 2112, 4160, 320, 0, 0, 4416, 0, 2304, 4352, 0,
+    0, 0, 0, 0, 0, 0, 0, 4356, 0, 0, 0, 0, 0, 4418, 0, 4161,
+    512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4164, 0, 0,
+    0, 0, 0, 4162, 0, 4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4121,
+    8, 0, 2053, 0, 2364, 0, 4104, 0, 2064, 0, 4112, 0, 0, 2064, 4112, 4112,
+    0, 0, 4104, 0, 2361, 2056, 0, 0, 0, 0, 1, 0, 4112, 0, 0, 2100,
+    4097, 513, 0, 0, 0, 4112, 0, 0, 0, 4112, 0, 4112, 4097, 513, 0, 2049,
+    0, 2352, 0, 0, 0, 0, 4116, 0, 4100, 2052, 0, 0, 0, 0, 4112, 306,
+    0, 305, 0, 4112, 0, 4112, 0, 0, 0, 0, 0, 2352, 0, 0, 0, 0,
+    4, 0, 4100, 0, 0, 2052, 4100, 300, 0, 0, 0, 519, 0, 0, 0, 519,
+    0, 0, 4105, 298, 0, 2345, 0, 2344, 0, 4360, 0, 0, 0, 294, 0, 0,
+    0, 293, 0, 4132, 0, 0, 0, 0, 0, 0, 0, 0, 519, 291, 0, 4128,
+    0, 0, 2080, 4129, 513, 0, 4100, 294, 0, 2052, 0, 4100, 0, 4356, 0, 519,
+    0, 0, 0, 0, 519, 0, 519, 0, 0, 4352, 0, 2337, 2304, 0, 0, 0,
+    0, 0, 4104, 0, 4097, 300, 0, 0, 0, 0, 2050, 4098, 0, 2049, 0, 2304,
+    0, 1027, 0, 0, 0, 0, 0, 4104, 0, 0, 0, 0, 4097, 513, 0, 2049,
+    0, 2304, 0, 0, 0, 4098, 0, 290, 0, 0, 4352, 1027, 0, 0, 0, 0,
+    0, 4097, 513, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0, 0,
+    0, 4098, 0, 4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2064, 0, 4116, 0, 0, 2068, 4112, 4112, 0, 0, 0, 282, 0, 0,
+    0, 4112, 0, 4368, 4104, 2056, 0, 2073, 0, 2328, 0, 4104, 0, 0, 0, 4112,
+    0, 0, 0, 4112, 0, 4112, 0, 0, 0, 0, 0, 0, 0, 0, 4112, 275,
+    0, 4112, 0, 0, 2064, 4113, 513, 0, 4100, 2068, 0, 2052, 0, 4100, 0, 4112,
+    0, 275, 0, 4368, 0, 0, 272, 4368, 4112, 0, 0, 2322, 0, 2321, 2320, 0,
+    0, 0, 0, 0, 0, 270, 0, 0, 0, 269, 0, 4108, 0, 0, 0, 0,
+    0, 0, 0, 0, 519, 2056, 0, 4104, 0, 0, 2056, 4104, 264, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 514, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 514, 0, 0, 0, 514, 0, 0, 2052, 0, 4100, 0, 0, 2052, 4100,
+    260, 0, 0, 0, 519, 0, 0, 0, 519, 0, 0, 2307, 2304, 0, 2305, 0,
+    2304, 0, 4352, 0, 2050, 4098, 0, 2053, 0, 2304, 0, 1027, 0, 4098, 0, 4352,
+    0, 0, 4352, 1027, 0, 0, 0, 4104, 0, 2313, 2056, 0, 0, 0, 0, 4098,
+    0, 262, 0, 0, 4352, 1027, 0, 0, 0, 0, 4354, 0, 0, 0, 0, 0,
+    1027, 4097, 513, 0, 2049, 0, 2304, 0, 0, 0, 0, 2050, 0, 4100, 2052, 0,
+    0, 0, 0, 4352, 4098, 0, 257, 0, 4352, 0, 1027, 0, 0, 0, 0, 0,
+    2304, 0, 0, 0, 0, 0, 4104, 0, 4101, 284, 0, 0, 0, 0, 4112, 282,
+    0, 281, 0, 4112, 0, 4120, 0, 0, 0, 0, 0, 4104, 0, 0, 0, 0,
+    4097, 513, 0, 2049, 0, 2324, 0, 0, 0, 275, 0, 4112, 0, 0, 2064, 4113,
+    513, 0, 0, 0, 0, 4097, 513, 0, 0, 0, 0, 0, 0, 0, 0, 4100,
+    0, 0, 0, 0, 0, 4114, 0, 4113, 512, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4100, 270, 0, 2052, 0, 4100, 0, 4364, 0, 519,
+    0, 0, 0, 0, 519, 0, 519, 0, 0, 4360, 0, 2304, 4352, 0, 0, 0,
+    0, 263, 0, 4100, 0, 0, 2052, 4101, 513, 0, 0, 0, 519, 0, 0, 0,
+    519, 0, 0, 4097, 513, 0, 4352, 0, 2304, 0, 0, 0, 0, 4356, 0, 4100,
+    260, 0, 0, 0, 0, 0, 519, 0, 519, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4352, 0, 0, 0, 0, 0, 0, 0, 0, 4108, 0, 0, 0, 0,
+    0, 4106, 0, 4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4097, 513, 0, 0, 0, 0, 4097, 513, 0, 2049, 0,
+    2304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0,
+    0, 0, 4098, 0, 4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 256, 0, 4352, 4352, 0, 0, 0, 0, 4352, 4352, 0, 4352,
+    0, 2304, 0, 304, 0, 0, 0, 0, 0, 304, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4352, 0, 2304, 4352, 0, 0,
+    0, 0, 4352, 4352, 0, 4352, 0, 296, 0, 4352, 0, 0, 0, 0, 0, 4352,
+    0, 0, 0, 0, 4128, 4352, 0, 4352, 0, 4128, 0, 4384, 0, 4352, 0, 4128,
+    0, 0, 4352, 4128, 4352, 0, 0, 4384, 0, 4128, 4352, 0, 0, 0, 0, 0,
+    0, 0, 0, 4356, 0, 0, 0, 0, 0, 4354, 0, 4097, 512, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 4098,
+    0, 4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4352, 0, 4352, 4352,
+    0, 0, 0, 0, 4352, 4352, 0, 4352, 0, 4352, 0, 4352, 0, 0, 0, 0,
+    0, 280, 0, 0, 0, 0, 4112, 4352, 0, 4352, 0, 4112, 0, 4112, 0, 4352,
+    0, 4368, 0, 0, 4352, 4368, 4368, 0, 0, 4112, 0, 4112, 4368, 0, 0, 0,
+    0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 4354, 0, 4353, 512, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4104, 4352, 0, 4352,
+    0, 4104, 0, 4360, 0, 4352, 0, 4360, 0, 0, 4360, 4360, 4352, 0, 0, 4360,
+    0, 4104, 4352, 0, 0, 0, 0, 514, 0, 0, 0, 0, 514, 0, 514, 0,
+    0, 0, 514, 0, 0, 0, 514, 0, 0, 0, 514, 0, 514, 0, 0, 0,
+    0, 0, 0, 4352, 0, 261, 4352, 0, 0, 0, 0, 4352, 4352, 0, 4353, 0,
+    1025, 0, 4352, 0, 0, 0, 0, 0, 4352, 0, 0, 0, 0, 0, 0, 0,
+    0, 4100, 0, 0, 0, 0, 0, 4354, 0, 4353, 512, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 0, 261, 4356, 0, 0, 0,
+    0, 4352, 4354, 0, 4352, 0, 4352, 0, 1027, 0, 0, 0, 0, 0, 1031, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0,
+    0, 0, 0, 4098, 0, 4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4356, 0, 0, 0, 0, 0, 4354, 0, 4097, 512, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4352, 0, 2304, 4352, 0,
+    0, 0, 0, 2304, 4352, 0, 4352, 0, 2304, 0, 4352, 0, 0, 0, 0, 0,
+    4352, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2064, 0, 4164, 0, 0, 2256, 4180, 2064, 0, 0, 0, 32, 0, 0, 0,
+    32, 0, 4128, 4289, 16, 0, 2192, 0, 4224, 0, 4112, 0, 0, 0, 2100, 0,
+    0, 0, 2064, 0, 4100, 0, 0, 0, 0, 0, 0, 0, 0, 32, 2049, 0,
+    2050, 0, 0, 2192, 4097, 240, 0, 4180, 2064, 0, 2064, 0, 4160, 0, 4112, 0,
+    32, 0, 4128, 0, 0, 4160, 4128, 240, 0, 0, 4112, 0, 4240, 4112, 0, 0,
+    0, 0, 0, 0, 2116, 0, 0, 0, 1, 0, 4100, 0, 0, 0, 0, 0,
+    0, 0, 0, 232, 2049, 0, 2050, 0, 0, 2176, 4097, 518, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4098, 0, 0, 0, 4097, 0, 1024, 1, 0, 4160, 0, 0, 4160, 4097, 518,
+    0, 0, 0, 4160, 0, 0, 0, 225, 0, 4192, 4097, 518, 0, 225, 0, 4224,
+    0, 0, 0, 2287, 2218, 0, 2093, 0, 2156, 0, 2176, 0, 2080, 0, 4128, 0,
+    0, 2080, 4128, 4224, 0, 0, 4160, 0, 2112, 4160, 0, 0, 0, 0, 2243, 0,
+    2246, 0, 0, 2276, 2176, 4224, 0, 0, 0, 2080, 0, 0, 0, 4224, 0, 4128,
+    4160, 4160, 0, 4160, 0, 2112, 0, 4160, 0, 0, 2080, 0, 2080, 4128, 0, 0,
+    0, 0, 4128, 4128, 0, 4128, 0, 4128, 0, 4128, 0, 0, 0, 0, 0, 224,
+    0, 0, 0, 0, 0, 0, 4100, 0, 0, 0, 4100, 0, 4100, 0, 0, 0,
+    0, 0, 0, 0, 0, 517, 4099, 0, 2, 0, 0, 4160, 1, 4112, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4098, 0, 0, 0, 4097, 0, 1024, 2052, 0, 4100, 0, 0, 4160,
+    4100, 212, 0, 0, 0, 517, 0, 0, 0, 517, 0, 0, 2113, 2064, 0, 4160,
+    0, 2112, 0, 4112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4098, 0, 0, 0, 4097, 0, 1024,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4160, 0, 0,
+    0, 197, 0, 4100, 0, 0, 0, 0, 0, 0, 0, 0, 517, 4097, 0, 194,
+    0, 0, 4160, 4097, 518, 0, 2052, 0, 4100, 0, 0, 2052, 4100, 4224, 0, 0,
+    0, 517, 0, 0, 0, 517, 0, 0, 2112, 4160, 0, 4160, 0, 2112, 0, 200,
+    0, 0, 0, 4100, 0, 0, 0, 4224, 0, 4100, 0, 0, 0, 0, 0, 0,
+    0, 0, 517, 4160, 0, 194, 0, 0, 4160, 193, 4288, 0, 4100, 2052, 0, 2052,
+    0, 4100, 0, 4100, 0, 517, 0, 0, 0, 0, 517, 0, 517, 0, 0, 2112,
+    0, 2112, 4160, 0, 0, 0, 0, 4304, 2064, 0, 2064, 0, 4224, 0, 4112, 0,
+    2064, 0, 4160, 0, 0, 4104, 4176, 4112, 0, 0, 4112, 0, 4240, 4112, 0, 0,
+    0, 0, 2113, 0, 2262, 0, 0, 2256, 4161, 212, 0, 0, 0, 2256, 0, 0,
+    0, 2128, 0, 4160, 4161, 210, 0, 209, 0, 4224, 0, 4176, 0, 0, 4112, 0,
+    4112, 4112, 0, 0, 0, 0, 4112, 4112, 0, 4112, 0, 208, 0, 4112, 0, 0,
+    0, 0, 0, 4112, 0, 0, 0, 0, 1, 0, 4288, 0, 0, 2176, 4097, 518,
+    0, 0, 0, 2112, 0, 0, 0, 201, 0, 4160, 4097, 518, 0, 201, 0, 4224,
+    0, 0, 0, 0, 0, 2246, 0, 0, 0, 2049, 0, 2052, 0, 0, 0, 0,
+    0, 0, 0, 0, 2112, 2049, 0, 2050, 0, 0, 2176, 4097, 518, 0, 4097, 518,
+    0, 197, 0, 4224, 0, 0, 0, 195, 0, 4160, 0, 0, 4160, 4161, 518, 0,
+    0, 0, 0, 4225, 518, 0, 0, 0, 0, 0, 2056, 0, 2056, 4104, 0, 0,
+    0, 0, 2056, 4104, 0, 4104, 0, 2056, 0, 200, 0, 0, 0, 0, 0, 200,
+    0, 0, 0, 0, 4160, 2112, 0, 2113, 0, 2244, 0, 4160, 0, 2243, 0, 2242,
+    0, 0, 2240, 2176, 4224, 0, 0, 4160, 0, 4160, 4160, 0, 0, 0, 0, 0,
+    0, 0, 0, 1026, 0, 0, 0, 0, 0, 1026, 0, 1026, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0,
+    128, 0, 4224, 0, 0, 0, 0, 0, 0, 0, 0, 184, 128, 0, 4224, 0,
+    0, 2176, 4224, 184, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4098, 0, 0, 0, 4097, 0, 1024,
+    128, 0, 4224, 0, 0, 128, 4224, 180, 0, 0, 0, 178, 0, 0, 0, 177,
+    0, 4272, 4224, 178, 0, 2176, 0, 4224, 0, 4240, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4098,
+    0, 0, 0, 4097, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 166, 0, 0, 0, 165, 0, 4228, 0, 0, 0, 0, 0, 0,
+    0, 0, 519, 163, 0, 4224, 0, 0, 2176, 4225, 518, 0, 2176, 0, 4224, 0,
+    0, 2176, 4224, 4224, 0, 0, 0, 170, 0, 0, 0, 4224, 0, 4256, 4224, 170,
+    0, 2176, 0, 4224, 0, 4232, 0, 0, 0, 2176, 0, 0, 0, 4224, 0, 4224,
+    0, 0, 0, 0, 0, 0, 0, 0, 4224, 163, 0, 4224, 0, 0, 2176, 4225,
+    513, 0, 4224, 4128, 0, 4128, 0, 4224, 0, 4224, 0, 4128, 0, 4256, 0, 0,
+    4128, 4256, 4256, 0, 0, 4224, 0, 4224, 4128, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4098, 0, 0, 0, 4097, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 150, 0, 0, 0, 149, 0, 4228, 0, 0, 0, 0,
+    0, 0, 0, 0, 517, 2176, 0, 4224, 0, 0, 2176, 4224, 144, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4098, 0, 0, 0, 4097, 0, 1024, 0,
+    0, 142, 0, 0, 0, 4224, 0, 4228, 0, 0, 0, 0, 0, 0, 0, 0,
+    517, 2176, 0, 4224, 0, 0, 2176, 4224, 4224, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4228, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4098, 0,
+    0, 0, 4225, 0, 1024, 135, 0, 4228, 0, 0, 132, 4228, 4224, 0, 0, 0,
+    517, 0, 0, 0, 517, 0, 0, 4224, 2176, 0, 2176, 0, 4224, 0, 4224, 0,
+    128, 0, 4224, 0, 0, 2176, 4224, 156, 0, 0, 0, 154, 0, 0, 0, 153,
+    0, 4240, 4224, 154, 0, 128, 0, 4224, 0, 4248, 0, 0, 0, 2176, 0, 0,
+    0, 149, 0, 4224, 0, 0, 0, 0, 0, 0, 0, 0, 144, 147, 0, 4224,
+    0, 0, 2176, 4225, 513, 0, 4224, 4112, 0, 4112, 0, 4224, 0, 4240, 0, 4112,
+    0, 4240, 0, 0, 4112, 4240, 4112, 0, 0, 4240, 0, 4224, 4112, 0, 0, 0,
+    0, 0, 0, 142, 0, 0, 0, 141, 0, 4228, 0, 0, 0, 0, 0, 0,
+    0, 0, 519, 139, 0, 4224, 0, 0, 2176, 4225, 518, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4098, 0, 0, 0, 4097, 0, 1024, 135, 0, 4228, 0, 0, 132, 4229, 518, 0,
+    0, 0, 519, 0, 0, 0, 519, 0, 0, 4225, 518, 0, 129, 0, 4224, 0,
+    0, 0, 4224, 4104, 0, 4104, 0, 4224, 0, 4232, 0, 4104, 0, 4224, 0, 0,
+    4104, 4224, 4232, 0, 0, 4232, 0, 4224, 4104, 0, 0, 0, 0, 135, 0, 4224,
+    0, 0, 2176, 4225, 513, 0, 0, 0, 2176, 0, 0, 0, 4224, 0, 4224, 4225,
+    513, 0, 129, 0, 4224, 0, 0, 0, 0, 1026, 0, 1026, 0, 0, 0, 0,
+    0, 1026, 0, 0, 0, 0, 1026, 0, 1026, 0, 0, 0, 0, 0, 1026, 0,
+    0, 0, 0, 4133, 16, 0, 2049, 0, 2056, 0, 4112, 0, 32, 0, 4128, 0,
+    0, 4104, 4128, 184, 0, 0, 4112, 0, 4112, 4112, 0, 0, 0, 0, 2096, 0,
+    4128, 0, 0, 2096, 4144, 4112, 0, 0, 0, 2080, 0, 0, 0, 2080, 0, 4128,
+    4112, 4112, 0, 4112, 0, 4112, 0, 4112, 0, 0, 4112, 0, 4097, 180, 0, 0,
+    0, 0, 4128, 178, 0, 4097, 0, 1025, 0, 4144, 0, 0, 0, 0, 0, 4112,
+    0, 0, 0, 0, 2049, 0, 2056, 0, 0, 4104, 4097, 518, 0, 0, 0, 4104,
+    0, 0, 0, 169, 0, 4128, 4097, 518, 0, 169, 0, 4224, 0, 0, 0, 0,
+    0, 2080, 0, 0, 0, 165, 0, 4128, 0, 0, 0, 0, 0, 0, 0, 0,
+    2080, 163, 0, 4128, 0, 0, 160, 4129, 518, 0, 4097, 518, 0, 4097, 0, 1025,
+    0, 0, 0, 4097, 0, 1025, 0, 0, 0, 4129, 518, 0, 0, 0, 0, 4225,
+    518, 0, 0, 0, 0, 0, 4100, 0, 4100, 4100, 0, 0, 0, 0, 4128, 170,
+    0, 169, 0, 4128, 0, 4128, 0, 0, 0, 0, 0, 1031, 0, 0, 0, 0,
+    2052, 4100, 0, 4100, 0, 2052, 0, 164, 0, 2080, 0, 4128, 0, 0, 2080, 4128,
+    4224, 0, 0, 1031, 0, 1031, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4100,
+    0, 0, 0, 0, 0, 4130, 0, 4129, 512, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 0, 4100, 0, 0, 4104, 4100, 156, 0, 0,
+    0, 517, 0, 0, 0, 517, 0, 0, 4112, 4112, 0, 4112, 0, 152, 0, 4112,
+    0, 0, 0, 150, 0, 0, 0, 149, 0, 4116, 0, 0, 0, 0, 0, 0,
+    0, 0, 517, 4112, 0, 4112, 0, 0, 4112, 4112, 4112, 0, 4100, 150, 0, 4097,
+    0, 1025, 0, 4116, 0, 517, 0, 0, 0, 0, 0, 0, 517, 0, 0, 4112,
+    0, 145, 4112, 0, 0, 0, 0, 0, 0, 4104, 0, 0, 0, 141, 0, 4108,
+    0, 0, 0, 0, 0, 0, 0, 0, 517, 139, 0, 4104, 0, 0, 4104, 4105,
+    518, 0, 0, 0, 0, 0, 0, 0, 0, 0, 514, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 514, 0, 0, 0, 514, 0, 0, 4097, 0, 1025,
+    0, 0, 0, 4101, 518, 0, 0, 0, 0, 0, 0, 0, 517, 0, 0, 4097,
+    518, 0, 4097, 0, 1025, 0, 0, 0, 4100, 4100, 0, 4100, 0, 4100, 0, 4100,
+    0, 517, 0, 0, 0, 0, 517, 0, 517, 0, 0, 1031, 0, 1031, 0, 0,
+    0, 0, 0, 4100, 0, 4100, 0, 0, 4100, 4100, 4228, 0, 0, 0, 517, 0,
+    0, 0, 517, 0, 0, 1031, 0, 0, 0, 0, 1031, 0, 1031, 0, 0, 4100,
+    0, 4100, 4100, 0, 0, 0, 0, 0, 517, 0, 517, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1031, 0, 0, 0, 0, 0, 4112, 0, 4113, 156, 0, 0,
+    0, 0, 4097, 154, 0, 2049, 0, 2056, 0, 4112, 0, 0, 0, 0, 0, 4112,
+    0, 0, 0, 0, 2199, 2064, 0, 2065, 0, 2196, 0, 4112, 0, 2067, 0, 2194,
+    0, 0, 2192, 2193, 2064, 0, 0, 4112, 0, 4112, 4112, 0, 0, 0, 0, 0,
+    0, 0, 0, 4116, 0, 0, 0, 0, 0, 4114, 0, 4097, 512, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4097, 518, 0, 141, 0, 4224,
+    0, 0, 0, 2049, 0, 2056, 0, 0, 4104, 4097, 518, 0, 0, 0, 0, 4225,
+    518, 0, 0, 0, 0, 2049, 0, 2182, 0, 0, 2176, 4097, 518, 0, 0, 0,
+    2178, 0, 0, 0, 2049, 0, 2176, 4097, 518, 0, 129, 0, 4224, 0, 0, 0,
+    0, 0, 0, 4225, 518, 0, 0, 0, 0, 4097, 518, 0, 4097, 0, 1025, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4100,
+    0, 0, 0, 0, 0, 4098, 0, 4097, 512, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2052, 0, 2052, 4100, 0, 0, 0, 0, 2179,
+    2050, 0, 2049, 0, 2176, 0, 2176, 0, 0, 0, 0, 0, 1031, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4160, 0,
+    0, 0, 2112, 0, 4160, 0, 0, 0, 0, 0, 0, 0, 0, 120, 64, 0,
+    4160, 0, 0, 120, 4160, 120, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4100,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4098, 0, 0, 0, 4097,
+    0, 1024, 4160, 0, 4160, 0, 0, 4160, 4160, 116, 0, 0, 0, 4160, 0, 0,
+    0, 113, 0, 4192, 4160, 114, 0, 113, 0, 4176, 0, 4176, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4098, 0, 0, 0, 4097, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4160, 0, 0, 0, 101, 0, 4160, 0, 0, 0, 0,
+    0, 0, 0, 0, 4160, 99, 0, 4162, 0, 0, 515, 4161, 518, 0, 2112, 0,
+    4160, 0, 0, 4160, 4160, 2112, 0, 0, 0, 106, 0, 0, 0, 105, 0, 4192,
+    4160, 4160, 0, 4160, 0, 4160, 0, 4160, 0, 0, 0, 2112, 0, 0, 0, 2112,
+    0, 4160, 0, 0, 0, 0, 0, 0, 0, 0, 96, 4160, 0, 4160, 0, 0,
+    4160, 4160, 4160, 0, 4160, 4128, 0, 4128, 0, 4160, 0, 4160, 0, 4128, 0, 4192,
+    0, 0, 4192, 4192, 4128, 0, 0, 4160, 0, 4160, 4192, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4098, 0, 0, 0, 4097, 0, 1024, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4160, 0, 0, 0, 85, 0, 4164, 0, 0,
+    0, 0, 0, 0, 0, 0, 517, 4160, 0, 4160, 0, 0, 4160, 4160, 80, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4164, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4162, 0, 0, 0, 4097, 0,
+    1024, 0, 0, 78, 0, 0, 0, 77, 0, 4164, 0, 0, 0, 0, 0, 0,
+    0, 0, 517, 4160, 0, 4160, 0, 0, 4160, 4160, 4160, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4162, 0, 0, 0, 4161, 0, 1024, 71, 0, 4164, 0, 0, 4160, 4164, 68, 0,
+    0, 0, 517, 0, 0, 0, 517, 0, 0, 4160, 4160, 0, 4160, 0, 4160, 0,
+    4160, 0, 64, 0, 4160, 0, 0, 92, 4160, 92, 0, 0, 0, 2112, 0, 0,
+    0, 2112, 0, 4160, 4160, 90, 0, 89, 0, 4176, 0, 4176, 0, 0, 0, 2112,
+    0, 0, 0, 2112, 0, 4160, 0, 0, 0, 0, 0, 0, 0, 0, 2112, 64,
+    0, 4160, 0, 0, 80, 4160, 80, 0, 4160, 4112, 0, 4112, 0, 4176, 0, 4176,
+    0, 4112, 0, 4160, 0, 0, 4176, 4160, 4112, 0, 0, 4176, 0, 4176, 4112, 0,
+    0, 0, 0, 0, 0, 78, 0, 0, 0, 77, 0, 4160, 0, 0, 0, 0,
+    0, 0, 0, 0, 2112, 75, 0, 4162, 0, 0, 515, 4161, 518, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4098, 0, 0, 0, 4097, 0, 1024, 71, 0, 4162, 0, 0, 515, 4161,
+    518, 0, 0, 0, 4160, 0, 0, 0, 65, 0, 4160, 4163, 518, 0, 515, 0,
+    0, 0, 0, 0, 4160, 4104, 0, 4104, 0, 4160, 0, 4160, 0, 4104, 0, 4160,
+    0, 0, 4104, 4160, 4104, 0, 0, 4160, 0, 4160, 4168, 0, 0, 0, 0, 2112,
+    0, 4160, 0, 0, 2112, 4160, 2112, 0, 0, 0, 2112, 0, 0, 0, 2112, 0,
+    4160, 4160, 4160, 0, 4160, 0, 4160, 0, 4160, 0, 0, 1026, 0, 1026, 0, 0,
+    0, 0, 0, 1026, 0, 0, 0, 0, 1026, 0, 1026, 0, 0, 0, 0, 0,
+    1026, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 516, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 516, 0, 0, 0, 516, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 516, 0, 0,
+    0, 516, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 516, 516, 0, 0,
+    0, 0, 516, 0, 516, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 516, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    516, 0, 0, 0, 516, 0, 0, 0, 0, 516, 0, 0, 0, 516, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 516, 516, 0, 0, 0, 0, 516, 0,
+    516, 0, 0, 0, 0, 0, 0, 0, 0, 0, 516, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 516, 0, 0, 0, 516, 0, 0, 516, 0, 0,
+    0, 0, 516, 0, 516, 0, 0, 0, 516, 0, 0, 0, 516, 0, 0, 0,
+    516, 0, 516, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 516, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 516, 0, 0, 0, 516, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 516, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 516, 0,
+    0, 0, 516, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 516, 0, 0, 0, 516, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 516, 516, 0, 0, 0, 0, 516, 0, 516, 0, 0, 0, 516, 0, 0,
+    0, 516, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 516, 516, 0, 0,
+    0, 0, 516, 0, 516, 0, 0, 0, 0, 0, 0, 0, 0, 0, 516, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 516, 0, 0, 0, 516, 0,
+    0, 516, 0, 0, 0, 0, 516, 0, 516, 0, 0, 0, 516, 0, 0, 0,
+    516, 0, 0, 0, 516, 0, 516, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 516, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    516, 0, 0, 0, 516, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 516, 0, 0, 0, 516, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 516, 516, 0, 0, 0, 0, 515, 0, 516, 0, 516, 0, 0,
+    0, 0, 516, 0, 516, 0, 0, 0, 516, 0, 0, 0, 516, 0, 0, 0,
+    516, 0, 516, 0, 0, 0, 0, 0, 0, 0, 516, 0, 0, 0, 516, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 516, 516, 0, 0, 0, 0, 516,
+    0, 513, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4105, 0,
+    8, 0, 0, 4104, 2053, 2064, 0, 0, 0, 4104, 0, 0, 0, 2080, 0, 4128,
+    4112, 4112, 0, 4112, 0, 4112, 0, 4112, 0, 0, 0, 4100, 0, 0, 0, 4100,
+    0, 2052, 0, 0, 0, 0, 0, 0, 0, 0, 2080, 4112, 0, 50, 0, 0,
+    4112, 49, 4112, 0, 1, 4112, 0, 4097, 0, 1025, 0, 4112, 0, 4097, 0, 1025,
+    0, 0, 0, 4128, 48, 0, 0, 4112, 0, 4112, 4112, 0, 0, 0, 0, 0,
+    0, 4104, 0, 0, 0, 4097, 0, 44, 0, 0, 0, 0, 0, 0, 0, 0,
+    4104, 43, 0, 4098, 0, 0, 515, 4097, 518, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4098, 0,
+    0, 0, 4097, 0, 1024, 4097, 0, 1025, 0, 0, 0, 4097, 518, 0, 0, 0,
+    0, 0, 0, 0, 4097, 0, 1025, 4099, 518, 0, 515, 0, 0, 0, 0, 0,
+    2052, 4100, 0, 4100, 0, 44, 0, 2052, 0, 2080, 0, 4128, 0, 0, 4104, 4128,
+    2080, 0, 0, 1031, 0, 1031, 0, 0, 0, 0, 0, 4100, 0, 2052, 0, 0,
+    4100, 2052, 4100, 0, 0, 0, 2080, 0, 0, 0, 2080, 0, 4128, 1031, 0, 0,
+    0, 0, 1031, 0, 1031, 0, 0, 38, 0, 37, 4132, 0, 0, 0, 0, 4128,
+    4128, 0, 4129, 0, 1025, 0, 4128, 0, 0, 0, 0, 0, 1031, 0, 0, 0,
+    0, 0, 0, 4104, 0, 0, 0, 4100, 0, 4100, 0, 0, 0, 0, 0, 0,
+    0, 0, 517, 4112, 0, 26, 0, 0, 4120, 25, 4112, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4114, 0, 0, 0, 4113, 0, 1024, 4097, 0, 1025, 0, 0, 0, 4100, 20, 0,
+    0, 0, 0, 0, 0, 0, 517, 0, 0, 19, 4112, 0, 4113, 0, 1025, 0,
+    4112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4108, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4106, 0, 0, 0, 4097, 0, 1024, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4097, 0,
+    1025, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4097, 0, 1025, 0, 0, 0,
+    4097, 518, 0, 4100, 0, 4100, 0, 0, 4108, 4100, 4100, 0, 0, 0, 517, 0,
+    0, 0, 517, 0, 0, 1031, 0, 0, 0, 0, 1031, 0, 1031, 0, 0, 0,
+    4100, 0, 0, 0, 4100, 0, 4100, 0, 0, 0, 0, 0, 0, 0, 0, 517,
+    0, 0, 1031, 0, 0, 0, 1031, 0, 0, 4100, 4100, 0, 4101, 0, 1025, 0,
+    4100, 0, 517, 0, 0, 0, 0, 0, 0, 517, 0, 0, 1031, 0, 1031, 0,
+    0, 0, 0, 0, 4112, 4112, 0, 4112, 0, 4112, 0, 4112, 0, 4104, 0, 2056,
+    0, 0, 4104, 2073, 2064, 0, 0, 4112, 0, 4112, 4112, 0, 0, 0, 0, 2067,
+    0, 2070, 0, 0, 2064, 2069, 2064, 0, 0, 0, 2066, 0, 0, 0, 2065, 0,
+    2064, 4112, 4112, 0, 4112, 0, 4112, 0, 4112, 0, 0, 4112, 0, 4112, 4112, 0,
+    0, 0, 0, 19, 4112, 0, 4113, 0, 1025, 0, 4112, 0, 0, 0, 0, 0,
+    4112, 0, 0, 0, 0, 15, 0, 4098, 0, 0, 515, 4097, 518, 0, 0, 0,
+    4104, 0, 0, 0, 2049, 0, 2056, 4099, 518, 0, 515, 0, 0, 0, 0, 0,
+    0, 0, 2050, 0, 0, 0, 2049, 0, 2052, 0, 0, 0, 0, 0, 0, 0,
+    0, 1536, 3, 0, 4098, 0, 0, 515, 4097, 518, 0, 4099, 518, 0, 515, 0,
+    0, 0, 0, 0, 4097, 0, 1025, 0, 0, 0, 4097, 518, 0, 0, 0, 0,
+    0, 515, 0, 0, 0, 0, 0, 14, 0, 13, 4108, 0, 0, 0, 0, 2056,
+    4104, 0, 4104, 0, 2056, 0, 2056, 0, 0, 0, 0, 0, 1031, 0, 0, 0,
+    0, 2052, 4100, 0, 4100, 0, 2052, 0, 2052, 0, 2051, 0, 2050, 0, 0, 1536,
+    2049, 1536, 0, 0, 1031, 0, 1031, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1026, 0, 0, 0, 0, 0, 1026, 0, 1026, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4148, 2064, 0, 2053, 0, 2172, 0, 4112, 0,
+    32, 0, 4128, 0, 0, 2080, 4128, 4112, 0, 0, 4112, 0, 2169, 2064, 0, 0,
+    0, 0, 2064, 0, 4128, 0, 0, 2100, 4112, 4112, 0, 0, 0, 2080, 0, 0,
+    0, 4112, 0, 4128, 4113, 114, 0, 2065, 0, 2160, 0, 4176, 0, 0, 4112, 0,
+    4101, 116, 0, 0, 0, 0, 4128, 114, 0, 113, 0, 4128, 0, 4144, 0, 0,
+    0, 0, 0, 4112, 0, 0, 0, 0, 1, 0, 4132, 0, 0, 2156, 4097, 518,
+    0, 0, 0, 106, 0, 0, 0, 105, 0, 4192, 4097, 518, 0, 2049, 0, 2152,
+    0, 0, 0, 0, 0, 2080, 0, 0, 0, 101, 0, 4128, 0, 0, 0, 0,
+    0, 0, 0, 0, 96, 99, 0, 4128, 0, 0, 2080, 4129, 518, 0, 4097, 518,
+    0, 2049, 0, 2112, 0, 0, 0, 99, 0, 4192, 0, 0, 4160, 4193, 518, 0,
+    0, 0, 0, 4097, 518, 0, 0, 0, 0, 0, 2050, 0, 4100, 2052, 0, 0,
+    0, 0, 4128, 4098, 0, 105, 0, 4128, 0, 1027, 0, 0, 0, 0, 0, 2112,
+    0, 0, 0, 0, 2050, 4098, 0, 2053, 0, 2148, 0, 1027, 0, 4098, 0, 4128,
+    0, 0, 2080, 1027, 0, 0, 0, 4160, 0, 2112, 4160, 0, 0, 0, 0, 0,
+    0, 0, 0, 4100, 0, 0, 0, 0, 0, 4130, 0, 4129, 512, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4100, 0, 0, 2052,
+    4100, 4112, 0, 0, 0, 517, 0, 0, 0, 517, 0, 0, 4112, 4112, 0, 2073,
+    0, 2136, 0, 4112, 0, 0, 0, 86, 0, 0, 0, 4112, 0, 4116, 0, 0,
+    0, 0, 0, 0, 0, 0, 517, 4112, 0, 4112, 0, 0, 2064, 4112, 4112, 0,
+    4100, 86, 0, 2052, 0, 4100, 0, 4116, 0, 517, 0, 0, 0, 0, 517, 0,
+    517, 0, 0, 4112, 0, 2129, 2064, 0, 0, 0, 0, 0, 0, 78, 0, 0,
+    0, 77, 0, 4108, 0, 0, 0, 0, 0, 0, 0, 0, 517, 75, 0, 4104,
+    0, 0, 2056, 4105, 518, 0, 0, 0, 0, 0, 0, 0, 0, 0, 514, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 514, 0, 0, 0, 514, 0,
+    0, 71, 0, 4100, 0, 0, 4160, 4101, 518, 0, 0, 0, 517, 0, 0, 0,
+    517, 0, 0, 4097, 518, 0, 2049, 0, 2112, 0, 0, 0, 4100, 4098, 0, 2052,
+    0, 4100, 0, 1027, 0, 517, 0, 0, 0, 0, 517, 0, 0, 0, 0, 74,
+    0, 2112, 4160, 0, 0, 0, 0, 4098, 0, 4100, 0, 0, 2052, 1027, 0, 0,
+    0, 0, 517, 0, 0, 0, 0, 0, 0, 67, 4162, 0, 4160, 0, 2112, 0,
+    1027, 0, 0, 4100, 0, 4100, 2052, 0, 0, 0, 0, 0, 517, 0, 517, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2112, 0, 0, 0, 0, 0, 4112, 0,
+    4097, 92, 0, 0, 0, 0, 4113, 90, 0, 2049, 0, 2136, 0, 4112, 0, 0,
+    0, 0, 0, 4112, 0, 0, 0, 0, 4097, 86, 0, 2049, 0, 2132, 0, 4176,
+    0, 2065, 0, 2130, 0, 0, 2128, 4112, 4112, 0, 0, 4176, 0, 4097, 80, 0,
+    0, 0, 0, 0, 0, 0, 0, 4116, 0, 0, 0, 0, 0, 4114, 0, 4097,
+    512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4097, 518,
+    0, 2049, 0, 2124, 0, 0, 0, 75, 0, 4160, 0, 0, 2112, 4161, 518, 0,
+    0, 0, 0, 4097, 518, 0, 0, 0, 0, 2049, 0, 2118, 0, 0, 2116, 4097,
+    518, 0, 0, 0, 2112, 0, 0, 0, 65, 0, 4160, 4097, 518, 0, 2049, 0,
+    2112, 0, 0, 0, 0, 0, 0, 4097, 518, 0, 0, 0, 0, 4161, 518, 0,
+    65, 0, 4160, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4100, 0, 0, 0, 0, 0, 4098, 0, 4097, 512, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4160, 0, 4097, 68, 0,
+    0, 0, 0, 2050, 4098, 0, 2049, 0, 2112, 0, 1027, 0, 0, 0, 0, 0,
+    4160, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2064, 0, 4100, 0, 0, 2100, 4112, 4112, 0, 0, 0, 58, 0, 0, 0, 4112,
+    0, 4144, 4097, 58, 0, 2073, 0, 2104, 0, 4120, 0, 0, 0, 4098, 0, 0,
+    0, 4112, 0, 52, 0, 0, 0, 0, 0, 0, 0, 0, 4112, 2049, 0, 2050,
+    0, 0, 2096, 4097, 513, 0, 4116, 4112, 0, 2068, 0, 4100, 0, 4112, 0, 51,
+    0, 4144, 0, 0, 48, 4144, 4112, 0, 0, 4112, 0, 2097, 2064, 0, 0, 0,
+    0, 0, 0, 2052, 0, 0, 0, 45, 0, 4100, 0, 0, 0, 0, 0, 0,
+    0, 0, 519, 2049, 0, 2050, 0, 0, 2088, 4097, 518, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4098, 0, 0, 0, 4097, 0, 1024, 39, 0, 4100, 0, 0, 2052, 4101, 518, 0,
+    0, 0, 519, 0, 0, 0, 519, 0, 0, 4097, 518, 0, 2049, 0, 2080, 0,
+    0, 0, 2050, 4098, 0, 2093, 0, 2092, 0, 1027, 0, 4098, 0, 4128, 0, 0,
+    2080, 1027, 0, 0, 0, 4104, 0, 2089, 2056, 0, 0, 0, 0, 4098, 0, 2050,
+    0, 0, 2084, 1027, 0, 0, 0, 0, 4098, 0, 0, 0, 0, 0, 1027, 4097,
+    513, 0, 2049, 0, 2080, 0, 0, 0, 0, 38, 0, 2080, 4128, 0, 0, 0,
+    0, 4128, 4130, 0, 4128, 0, 4128, 0, 1027, 0, 0, 0, 0, 0, 2080, 0,
+    0, 0, 0, 0, 0, 2052, 0, 0, 0, 4112, 0, 4100, 0, 0, 0, 0,
+    0, 0, 0, 0, 517, 4098, 0, 2050, 0, 0, 2072, 25, 4112, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4116, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4098, 0, 0, 0, 4113, 0, 1024, 2052, 0, 4100, 0, 0, 2052, 4100,
+    4112, 0, 0, 0, 517, 0, 0, 0, 517, 0, 0, 2067, 2064, 0, 2065, 0,
+    2064, 0, 4112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4098, 0, 0, 0, 4097, 0, 1024, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2052, 0, 0, 0,
+    5, 0, 4100, 0, 0, 0, 0, 0, 0, 0, 0, 517, 2049, 0, 2050, 0,
+    0, 1536, 4097, 518, 0, 4098, 0, 4100, 0, 0, 2052, 1027, 0, 0, 0, 0,
+    517, 0, 0, 0, 0, 0, 0, 2050, 4098, 0, 2057, 0, 2056, 0, 1027, 0,
+    0, 0, 4098, 0, 0, 0, 0, 0, 1027, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4098, 0, 2050, 0, 0, 1536, 1027, 0, 0, 4100, 4098, 0, 2052, 0,
+    4100, 0, 1027, 0, 517, 0, 0, 0, 0, 517, 0, 0, 0, 0, 2050, 0,
+    2049, 1536, 0, 0, 0, 0, 4113, 30, 0, 2065, 0, 2076, 0, 4120, 0, 4112,
+    0, 4112, 0, 0, 2064, 4112, 4112, 0, 0, 4120, 0, 4097, 24, 0, 0, 0,
+    0, 2049, 0, 2070, 0, 0, 2068, 4097, 513, 0, 0, 0, 2064, 0, 0, 0,
+    4112, 0, 4112, 4097, 513, 0, 2049, 0, 2064, 0, 0, 0, 0, 4112, 0, 4112,
+    4112, 0, 0, 0, 0, 4112, 4112, 0, 4112, 0, 4112, 0, 4112, 0, 0, 0,
+    0, 0, 4112, 0, 0, 0, 0, 15, 0, 4100, 0, 0, 2052, 4101, 518, 0,
+    0, 0, 519, 0, 0, 0, 519, 0, 0, 4097, 518, 0, 2049, 0, 2056, 0,
+    0, 0, 0, 0, 2052, 0, 0, 0, 5, 0, 4100, 0, 0, 0, 0, 0,
+    0, 0, 0, 519, 2049, 0, 2050, 0, 0, 1536, 4097, 513, 0, 4101, 518, 0,
+    5, 0, 4100, 0, 0, 0, 519, 0, 0, 0, 0, 519, 0, 518, 0, 0,
+    0, 0, 4097, 518, 0, 0, 0, 0, 0, 4104, 0, 2056, 4104, 0, 0, 0,
+    0, 11, 4106, 0, 4104, 0, 2056, 0, 1027, 0, 0, 0, 0, 0, 4104, 0,
+    0, 0, 0, 4097, 513, 0, 2049, 0, 2052, 0, 0, 0, 4098, 0, 2050, 0,
+    0, 1536, 1027, 0, 0, 0, 0, 0, 4097, 513, 0, 0, 0, 0, 0, 0,
+    0, 0, 1026, 0, 0, 0, 0, 0, 1026, 0, 1026, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4112, 0, 4101, 60, 0, 0,
+    0, 0, 4128, 58, 0, 57, 0, 4128, 0, 4144, 0, 0, 0, 0, 0, 4112,
+    0, 0, 0, 0, 4144, 4112, 0, 53, 0, 4128, 0, 4112, 0, 32, 0, 4128,
+    0, 0, 2080, 4128, 4112, 0, 0, 4112, 0, 4112, 4112, 0, 0, 0, 0, 0,
+    0, 0, 0, 4116, 0, 0, 0, 0, 0, 4146, 0, 4129, 512, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4097, 518, 0, 2049, 0, 2056,
+    0, 0, 0, 43, 0, 4128, 0, 0, 4104, 4129, 518, 0, 0, 0, 0, 4097,
+    518, 0, 0, 0, 0, 39, 0, 4128, 0, 0, 2080, 4129, 518, 0, 0, 0,
+    2080, 0, 0, 0, 33, 0, 4128, 4129, 518, 0, 33, 0, 4128, 0, 0, 0,
+    0, 0, 0, 4097, 518, 0, 0, 0, 0, 4129, 518, 0, 4097, 0, 1025, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4100,
+    0, 0, 0, 0, 0, 4130, 0, 4129, 512, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 38, 0, 4100, 4100, 0, 0, 0, 0, 4128,
+    4098, 0, 33, 0, 4128, 0, 1027, 0, 0, 0, 0, 0, 1031, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 30, 0, 4,
+    0, 4100, 0, 4116, 0, 517, 0, 0, 0, 0, 517, 0, 517, 0, 0, 4112,
+    0, 4112, 4112, 0, 0, 0, 0, 23, 0, 4116, 0, 0, 20, 4116, 4112, 0,
+    0, 0, 517, 0, 0, 0, 517, 0, 0, 4112, 4112, 0, 4112, 0, 4112, 0,
+    4112, 0, 0, 4116, 0, 4100, 20, 0, 0, 0, 0, 0, 517, 0, 517, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4112, 0, 0, 0, 0, 15, 0, 4108,
+    0, 0, 4104, 4109, 518, 0, 0, 0, 517, 0, 0, 0, 517, 0, 0, 4105,
+    518, 0, 9, 0, 4104, 0, 0, 0, 0, 0, 514, 0, 0, 0, 514, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 514, 514, 0, 0, 0, 0, 514,
+    0, 514, 0, 4101, 518, 0, 4097, 0, 1025, 0, 0, 0, 517, 0, 0, 0,
+    0, 0, 0, 517, 0, 0, 0, 0, 4097, 518, 0, 0, 0, 0, 0, 4100,
+    0, 4100, 4100, 0, 0, 0, 0, 0, 517, 0, 517, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1031, 0, 0, 0, 0, 4100, 4102, 0, 4100, 0, 4100, 0,
+    1027, 0, 517, 0, 0, 0, 0, 517, 0, 0, 0, 0, 1031, 0, 1031, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 0, 0,
+    0, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4116, 0, 0, 0, 0, 0, 4114, 0, 4097, 512, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4112, 0, 4097, 20, 0,
+    0, 0, 0, 4097, 18, 0, 2049, 0, 2064, 0, 4112, 0, 0, 0, 0, 0,
+    4112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4097, 518, 0, 0, 0, 0, 4097, 518, 0, 2049, 0, 2056, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4097, 518, 0, 2049, 0,
+    2052, 0, 0, 0, 2049, 0, 2050, 0, 0, 1536, 4097, 518, 0, 0, 0, 0,
+    4097, 518, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4100, 0, 0, 0, 0, 0, 4098, 0, 4097, 512, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4164, 0, 4100, 4100, 0, 0, 0, 0, 4163, 2, 0, 1, 0,
+    4112, 0, 4160, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 4160, 4160, 0,
+    4164, 0, 4112, 0, 4160, 0, 2112, 0, 4112, 0, 0, 4112, 4176, 2112, 0, 0,
+    4160, 0, 32, 4128, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0,
+    0, 0, 4098, 0, 4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2287, 2116, 0, 2176, 0, 4224, 0, 4168, 0, 2112, 0, 4160, 0,
+    0, 232, 4160, 2112, 0, 0, 2080, 0, 4224, 4128, 0, 0, 0, 0, 2080, 0,
+    4128, 0, 0, 228, 4128, 228, 0, 0, 0, 226, 0, 0, 0, 225, 0, 4192,
+    4128, 4128, 0, 4128, 0, 4256, 0, 4192, 0, 0, 4102, 0, 4224, 228, 0, 0,
+    0, 0, 4160, 226, 0, 225, 0, 4288, 0, 4160, 0, 0, 0, 0, 0, 4224,
+    0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 4098, 0,
+    4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4160, 0, 4097, 228, 0, 0, 0, 0, 4097, 226, 0, 4097, 0, 1030, 0, 4160,
+    0, 0, 0, 0, 0, 4160, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2257, 2136, 0, 4160, 0, 4112, 0, 4104, 0, 4288, 0,
+    4112, 0, 0, 4112, 4112, 4224, 0, 0, 4104, 0, 4112, 4160, 0, 0, 0, 0,
+    4112, 0, 4112, 0, 0, 4112, 4112, 212, 0, 0, 0, 4112, 0, 0, 0, 4112,
+    0, 4112, 4112, 210, 0, 4112, 0, 4112, 0, 4176, 0, 0, 2262, 0, 2257, 2052,
+    0, 0, 0, 0, 2113, 2050, 0, 4097, 0, 208, 0, 2256, 0, 0, 0, 0,
+    0, 2256, 0, 0, 0, 0, 2056, 0, 4104, 0, 0, 204, 4104, 2056, 0, 0,
+    0, 202, 0, 0, 0, 201, 0, 4168, 4104, 2056, 0, 201, 0, 4232, 0, 4104,
+    0, 0, 0, 514, 0, 0, 0, 514, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 514, 514, 0, 0, 0, 0, 514, 0, 514, 0, 2243, 2246, 0, 2176,
+    0, 4224, 0, 2244, 0, 4160, 0, 4160, 0, 0, 4160, 4160, 2112, 0, 0, 2242,
+    0, 4224, 2176, 0, 0, 0, 0, 0, 2246, 0, 2049, 2052, 0, 0, 0, 0,
+    2049, 2050, 0, 4097, 0, 1030, 0, 2176, 0, 0, 0, 0, 0, 2112, 0, 0,
+    0, 0, 1, 4160, 0, 4097, 0, 1030, 0, 4160, 0, 4097, 0, 1030, 0, 0,
+    0, 193, 4224, 0, 0, 4160, 0, 193, 4160, 0, 0, 0, 0, 0, 0, 0,
+    0, 4100, 0, 0, 0, 0, 0, 4098, 0, 4097, 512, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0,
+    0, 0, 4098, 0, 4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4160, 0, 4100, 4100, 0, 0, 0, 0, 4161, 210, 0, 1,
+    0, 4112, 0, 4160, 0, 0, 0, 0, 0, 1029, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 4224, 4100, 0, 0,
+    0, 0, 4160, 202, 0, 201, 0, 4288, 0, 4160, 0, 0, 0, 0, 0, 1029,
+    0, 0, 0, 0, 2052, 4100, 0, 4100, 0, 4224, 0, 4160, 0, 2112, 0, 4160,
+    0, 0, 192, 4160, 2112, 0, 0, 1029, 0, 1029, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4228, 0, 0, 0, 0, 0, 4162, 0, 4289, 512, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4164, 0, 0, 0, 0, 0, 4162,
+    0, 4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4109, 8, 0, 2052, 0,
+    4112, 0, 4104, 0, 16, 0, 4112, 0, 0, 4112, 4112, 184, 0, 0, 4104, 0,
+    2080, 4128, 0, 0, 0, 0, 1, 0, 4112, 0, 0, 4112, 4097, 513, 0, 0,
+    0, 4112, 0, 0, 0, 177, 0, 4112, 4097, 513, 0, 4128, 0, 176, 0, 0,
+    0, 0, 4100, 0, 4116, 2052, 0, 0, 0, 0, 4112, 178, 0, 177, 0, 4112,
+    0, 4112, 0, 0, 0, 0, 0, 2080, 0, 0, 0, 0, 2052, 0, 4100, 0,
+    0, 172, 4100, 172, 0, 0, 0, 519, 0, 0, 0, 519, 0, 0, 2080, 4128,
+    0, 4128, 0, 4224, 0, 4104, 0, 0, 0, 166, 0, 0, 0, 165, 0, 4132,
+    0, 0, 0, 0, 0, 0, 0, 0, 519, 4128, 0, 4128, 0, 0, 4128, 4129,
+    513, 0, 4100, 2052, 0, 165, 0, 4228, 0, 4100, 0, 519, 0, 0, 0, 0,
+    519, 0, 519, 0, 0, 2080, 0, 4224, 4128, 0, 0, 0, 0, 0, 4104, 0,
+    4097, 172, 0, 0, 0, 0, 4097, 170, 0, 4097, 0, 1030, 0, 4104, 0, 0,
+    0, 0, 0, 4104, 0, 0, 0, 0, 4097, 513, 0, 4097, 0, 1030, 0, 0,
+    0, 4097, 0, 1030, 0, 0, 0, 4097, 513, 0, 0, 0, 0, 4097, 513, 0,
+    0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 4098, 0, 4097,
+    512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2072, 0,
+    4112, 0, 0, 4112, 4120, 2056, 0, 0, 0, 4112, 0, 0, 0, 4112, 0, 4112,
+    4104, 2056, 0, 2072, 0, 4112, 0, 4104, 0, 0, 0, 4112, 0, 0, 0, 149,
+    0, 4112, 0, 0, 0, 0, 0, 0, 0, 0, 4112, 147, 0, 4112, 0, 0,
+    4112, 4113, 513, 0, 2199, 2070, 0, 2068, 0, 4112, 0, 2196, 0, 2064, 0, 4112,
+    0, 0, 4112, 4112, 2064, 0, 0, 2194, 0, 2193, 2192, 0, 0, 0, 0, 0,
+    0, 142, 0, 0, 0, 141, 0, 4108, 0, 0, 0, 0, 0, 0, 0, 0,
+    519, 2056, 0, 4104, 0, 0, 136, 4104, 2056, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 514, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 514, 0,
+    0, 0, 514, 0, 0, 2052, 0, 4100, 0, 0, 132, 4100, 2052, 0, 0, 0,
+    519, 0, 0, 0, 519, 0, 0, 2179, 2178, 0, 2176, 0, 4224, 0, 2176, 0,
+    2049, 2056, 0, 4097, 0, 1030, 0, 4104, 0, 4097, 0, 1030, 0, 0, 0, 137,
+    4224, 0, 0, 4104, 0, 2049, 2056, 0, 0, 0, 0, 4097, 0, 1030, 0, 0,
+    0, 4097, 513, 0, 0, 0, 0, 0, 0, 0, 4225, 0, 1030, 4097, 513, 0,
+    4097, 0, 1030, 0, 0, 0, 0, 2182, 0, 2049, 2052, 0, 0, 0, 0, 2049,
+    2050, 0, 4097, 0, 1030, 0, 2176, 0, 0, 0, 0, 0, 2176, 0, 0, 0,
+    0, 0, 4104, 0, 4100, 4100, 0, 0, 0, 0, 4112, 154, 0, 153, 0, 4112,
+    0, 4120, 0, 0, 0, 0, 0, 1029, 0, 0, 0, 0, 4097, 513, 0, 4100,
+    0, 148, 0, 0, 0, 147, 0, 4112, 0, 0, 4112, 4113, 513, 0, 0, 0,
+    0, 1029, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0, 0,
+    0, 4114, 0, 4113, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4100, 4100, 0, 4100, 0, 4228, 0, 4108, 0, 519, 0, 0, 0, 0,
+    519, 0, 519, 0, 0, 1029, 0, 1029, 0, 0, 0, 0, 0, 4100, 0, 4100,
+    0, 0, 4100, 4101, 513, 0, 0, 0, 519, 0, 0, 0, 519, 0, 0, 1029,
+    0, 0, 0, 0, 1029, 0, 0, 0, 0, 4100, 0, 4228, 4100, 0, 0, 0,
+    0, 0, 519, 0, 519, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1029, 0,
+    0, 0, 0, 0, 0, 0, 0, 4108, 0, 0, 0, 0, 0, 4106, 0, 4097,
+    512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4097, 513, 0, 0, 0, 0, 4097, 513, 0, 4097, 0, 1030, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 4098, 0,
+    4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 0, 128, 4224, 0, 0, 0, 0, 2176, 4224, 0, 4224, 0, 176, 0, 2176,
+    0, 0, 0, 0, 0, 176, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2176, 0, 4224, 4224, 0, 0, 0, 0, 2176, 4224,
+    0, 4224, 0, 4224, 0, 2176, 0, 0, 0, 0, 0, 4224, 0, 0, 0, 0,
+    4128, 4224, 0, 4224, 0, 4256, 0, 4128, 0, 4224, 0, 4128, 0, 0, 4224, 4128,
+    4224, 0, 0, 4128, 0, 4256, 4256, 0, 0, 0, 0, 0, 0, 0, 0, 4228,
+    0, 0, 0, 0, 0, 4098, 0, 4225, 512, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 4098, 0, 4097, 512, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2176, 0, 128, 4224, 0, 0, 0, 0,
+    128, 4224, 0, 4224, 0, 152, 0, 2176, 0, 0, 0, 0, 0, 152, 0, 0,
+    0, 0, 4112, 4224, 0, 4224, 0, 4112, 0, 4112, 0, 4224, 0, 4112, 0, 0,
+    4240, 4112, 4224, 0, 0, 4112, 0, 4112, 4240, 0, 0, 0, 0, 0, 0, 0,
+    0, 4100, 0, 0, 0, 0, 0, 4098, 0, 4097, 512, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4104, 4224, 0, 4224, 0, 4232, 0, 4104,
+    0, 4224, 0, 4104, 0, 0, 4232, 4104, 4224, 0, 0, 4104, 0, 4232, 4224, 0,
+    0, 0, 0, 514, 0, 0, 0, 0, 514, 0, 514, 0, 0, 0, 514, 0,
+    0, 0, 514, 0, 0, 0, 514, 0, 514, 0, 0, 0, 0, 0, 0, 2176,
+    0, 4224, 4224, 0, 0, 0, 0, 131, 4224, 0, 4225, 0, 1025, 0, 2176, 0,
+    0, 0, 0, 0, 4224, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0,
+    0, 0, 0, 4098, 0, 4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 134, 0, 133, 4228, 0, 0, 0, 0, 131, 4224, 0,
+    4225, 0, 1030, 0, 2176, 0, 0, 0, 0, 0, 1031, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 4098,
+    0, 4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4228,
+    0, 0, 0, 0, 0, 4098, 0, 4225, 512, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 134, 0, 4224, 4228, 0, 0, 0, 0, 2176,
+    4224, 0, 4224, 0, 4224, 0, 2176, 0, 0, 0, 0, 0, 1029, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2101, 2070, 0,
+    4112, 0, 4112, 0, 2172, 0, 2066, 0, 4112, 0, 0, 4112, 2169, 2136, 0, 0,
+    2080, 0, 4112, 4128, 0, 0, 0, 0, 4100, 0, 4112, 0, 0, 4112, 2101, 2112,
+    0, 0, 0, 4112, 0, 0, 0, 2128, 0, 4112, 32, 4128, 0, 4128, 0, 4112,
+    0, 4160, 0, 0, 4098, 0, 4112, 116, 0, 0, 0, 0, 4114, 2050, 0, 113,
+    0, 4112, 0, 2160, 0, 0, 0, 0, 0, 4112, 0, 0, 0, 0, 2050, 0,
+    4098, 0, 0, 515, 2093, 2156, 0, 0, 0, 106, 0, 0, 0, 2112, 0, 4160,
+    4098, 4128, 0, 515, 0, 0, 0, 2080, 0, 0, 0, 102, 0, 0, 0, 2080,
+    0, 4128, 0, 0, 0, 0, 0, 0, 0, 0, 96, 4128, 0, 4130, 0, 0,
+    515, 4128, 4128, 0, 4098, 2050, 0, 515, 0, 0, 0, 2148, 0, 99, 0, 4162,
+    0, 0, 515, 4160, 2112, 0, 0, 4098, 0, 0, 515, 0, 0, 0, 0, 0,
+    2156, 0, 1, 4100, 0, 0, 0, 0, 2049, 2050, 0, 4097, 0, 1030, 0, 2152,
+    0, 0, 0, 0, 0, 104, 0, 0, 0, 0, 2049, 2112, 0, 4097, 0, 1030,
+    0, 4160, 0, 4097, 0, 1030, 0, 0, 0, 2049, 2112, 0, 0, 4160, 0, 97,
+    4192, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 4098,
+    0, 4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2074, 0, 4112, 0, 0, 4112, 2077, 2136, 0, 0, 0, 4112, 0, 0, 0, 2136,
+    0, 4112, 4112, 2072, 0, 4112, 0, 4112, 0, 4104, 0, 0, 0, 4112, 0, 0,
+    0, 2064, 0, 4112, 0, 0, 0, 0, 0, 0, 0, 0, 4112, 4112, 0, 4112,
+    0, 0, 4112, 4112, 80, 0, 2131, 2070, 0, 2064, 0, 4112, 0, 2132, 0, 4097,
+    0, 82, 0, 0, 4176, 2129, 2128, 0, 0, 2130, 0, 4112, 2064, 0, 0, 0,
+    0, 0, 0, 78, 0, 0, 0, 2056, 0, 4104, 0, 0, 0, 0, 0, 0,
+    0, 0, 72, 75, 0, 4106, 0, 0, 515, 4104, 2056, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 514, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    514, 0, 0, 0, 514, 0, 0, 2050, 0, 4098, 0, 0, 515, 2117, 2116, 0,
+    0, 0, 4160, 0, 0, 0, 2112, 0, 4160, 4098, 2050, 0, 515, 0, 0, 0,
+    2112, 0, 2049, 2126, 0, 4097, 0, 1030, 0, 2124, 0, 4097, 0, 1030, 0, 0,
+    0, 2049, 2120, 0, 0, 2112, 0, 73, 4160, 0, 0, 0, 0, 4097, 0, 1030,
+    0, 0, 0, 2049, 2112, 0, 0, 0, 0, 0, 0, 0, 4097, 0, 1030, 67,
+    4160, 0, 4161, 0, 1030, 0, 4160, 0, 0, 2118, 0, 2049, 2052, 0, 0, 0,
+    0, 2049, 2050, 0, 4097, 0, 1030, 0, 2112, 0, 0, 0, 0, 0, 2112, 0,
+    0, 0, 0, 0, 4100, 0, 4112, 4100, 0, 0, 0, 0, 4114, 2, 0, 89,
+    0, 4112, 0, 4160, 0, 0, 0, 0, 0, 1029, 0, 0, 0, 0, 4100, 4100,
+    0, 4100, 0, 4112, 0, 4160, 0, 83, 0, 4112, 0, 0, 4112, 4160, 2112, 0,
+    0, 1029, 0, 1029, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4116, 0, 0,
+    0, 0, 0, 4098, 0, 4113, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4098, 4100, 0, 515, 0, 0, 0, 2052, 0, 75, 0, 4162,
+    0, 0, 515, 4160, 2112, 0, 0, 1029, 0, 0, 0, 0, 0, 0, 0, 4100,
+    0, 4098, 0, 0, 515, 2052, 4100, 0, 0, 0, 66, 0, 0, 0, 2112, 0,
+    4160, 1029, 0, 0, 0, 0, 0, 0, 1029, 0, 0, 4098, 0, 0, 515, 0,
+    0, 0, 0, 4162, 66, 0, 515, 0, 0, 0, 4160, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 4098,
+    0, 4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4160, 0, 69, 4100, 0, 0, 0, 0, 4097, 66, 0, 4097, 0, 1030, 0,
+    4160, 0, 0, 0, 0, 0, 1029, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4132, 0, 4112, 0, 0, 4112, 2053, 2056, 0, 0,
+    0, 4112, 0, 0, 0, 2064, 0, 4112, 32, 4128, 0, 4128, 0, 4112, 0, 4104,
+    0, 0, 0, 4112, 0, 0, 0, 4097, 0, 52, 0, 0, 0, 0, 0, 0,
+    0, 0, 4112, 4128, 0, 50, 0, 0, 4144, 4097, 513, 0, 4112, 4128, 0, 4112,
+    0, 4112, 0, 2100, 0, 4112, 0, 4112, 0, 0, 4112, 4112, 2064, 0, 0, 2080,
+    0, 4112, 4128, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 4100, 0, 4100,
+    0, 0, 0, 0, 0, 0, 0, 0, 519, 4128, 0, 4098, 0, 0, 515, 41,
+    4128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4130, 0, 0, 0, 4129, 0, 1024, 39, 0, 4102,
+    0, 0, 515, 4100, 2052, 0, 0, 0, 519, 0, 0, 0, 519, 0, 0, 4098,
+    4128, 0, 515, 0, 0, 0, 2080, 0, 2049, 2056, 0, 4097, 0, 1030, 0, 4104,
+    0, 4097, 0, 1030, 0, 0, 0, 2049, 2056, 0, 0, 4104, 0, 41, 4128, 0,
+    0, 0, 0, 4097, 0, 1030, 0, 0, 0, 4097, 513, 0, 0, 0, 0, 0,
+    0, 0, 4097, 0, 1030, 4097, 513, 0, 4129, 0, 1030, 0, 0, 0, 0, 2080,
+    0, 37, 4128, 0, 0, 0, 0, 35, 4128, 0, 4129, 0, 1030, 0, 2080, 0,
+    0, 0, 0, 0, 2080, 0, 0, 0, 0, 0, 0, 4112, 0, 0, 0, 4097,
+    0, 28, 0, 0, 0, 0, 0, 0, 0, 0, 4112, 4097, 0, 26, 0, 0,
+    4112, 2049, 2056, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4116, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4114, 0, 0, 0, 4097, 0, 1024, 2070,
+    0, 4112, 0, 0, 4112, 2069, 2068, 0, 0, 0, 4112, 0, 0, 0, 2064, 0,
+    4112, 2067, 2066, 0, 2064, 0, 4112, 0, 2064, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4098, 0,
+    0, 0, 4097, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 6, 0, 0, 0, 2052, 0, 4100, 0, 0, 0, 0, 0, 0, 0,
+    0, 519, 2050, 0, 4098, 0, 0, 515, 2049, 1536, 0, 4097, 0, 1030, 0, 0,
+    0, 2049, 2056, 0, 0, 0, 0, 0, 0, 0, 4097, 0, 1030, 2049, 2056, 0,
+    4097, 0, 1030, 0, 4104, 0, 0, 0, 0, 0, 0, 0, 4097, 0, 1030, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4097, 0, 1030, 0, 0, 0, 4097, 513,
+    0, 2049, 2054, 0, 4097, 0, 1030, 0, 2052, 0, 4097, 0, 1030, 0, 0, 0,
+    2049, 1536, 0, 0, 2050, 0, 2049, 1536, 0, 0, 0, 0, 4, 4100, 0, 4100,
+    0, 4112, 0, 4104, 0, 4112, 0, 4112, 0, 0, 4112, 4112, 24, 0, 0, 1029,
+    0, 1029, 0, 0, 0, 0, 0, 4100, 0, 22, 0, 0, 4116, 4097, 513, 0,
+    0, 0, 4112, 0, 0, 0, 17, 0, 4112, 1029, 0, 0, 0, 0, 1029, 0,
+    0, 0, 0, 22, 0, 4112, 4116, 0, 0, 0, 0, 4112, 4112, 0, 4112, 0,
+    4112, 0, 4112, 0, 0, 0, 0, 0, 1029, 0, 0, 0, 0, 4100, 0, 4102,
+    0, 0, 515, 4100, 4100, 0, 0, 0, 519, 0, 0, 0, 519, 0, 0, 1029,
+    0, 0, 0, 0, 0, 0, 1029, 0, 0, 0, 4100, 0, 0, 0, 4100, 0,
+    4100, 0, 0, 0, 0, 0, 0, 0, 0, 519, 0, 0, 1029, 0, 0, 0,
+    1029, 0, 0, 4102, 4100, 0, 515, 0, 0, 0, 4100, 0, 519, 0, 0, 0,
+    0, 515, 0, 519, 0, 0, 1029, 0, 0, 0, 0, 0, 0, 0, 0, 4104,
+    0, 13, 4108, 0, 0, 0, 0, 11, 4104, 0, 4105, 0, 1030, 0, 4104, 0,
+    0, 0, 0, 0, 1029, 0, 0, 0, 0, 4097, 513, 0, 4101, 0, 1030, 0,
+    0, 0, 4097, 0, 1030, 0, 0, 0, 4097, 513, 0, 0, 0, 0, 1029, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1026, 0, 0, 0, 0, 0, 1026, 0,
+    1026, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4098, 0, 4112, 60, 0, 0, 0, 0, 4098, 2050, 0, 57, 0, 4112, 0, 2104,
+    0, 0, 0, 0, 0, 4112, 0, 0, 0, 0, 4112, 4100, 0, 4112, 0, 4112,
+    0, 2100, 0, 2066, 0, 4112, 0, 0, 4112, 2097, 2096, 0, 0, 50, 0, 4112,
+    4144, 0, 0, 0, 0, 0, 0, 0, 0, 4116, 0, 0, 0, 0, 0, 4098,
+    0, 4113, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4098, 2050, 0, 515, 0, 0, 0, 2092, 0, 2050, 0, 4098, 0, 0, 515, 2089,
+    2088, 0, 0, 4098, 0, 0, 515, 0, 0, 0, 0, 39, 0, 4130, 0, 0,
+    515, 4128, 2080, 0, 0, 0, 34, 0, 0, 0, 2080, 0, 4128, 4130, 4128, 0,
+    515, 0, 0, 0, 4128, 0, 0, 4098, 0, 0, 515, 0, 0, 0, 0, 4098,
+    2050, 0, 515, 0, 0, 0, 2080, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 4098, 0, 4097, 512, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2052, 0, 37,
+    4100, 0, 0, 0, 0, 2049, 2050, 0, 4097, 0, 1030, 0, 2080, 0, 0, 0,
+    0, 0, 1031, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4112, 2066, 0, 4112, 0, 4112, 0, 2076, 0, 4097, 0, 26, 0, 0,
+    4120, 2073, 2072, 0, 0, 4112, 0, 4112, 4112, 0, 0, 0, 0, 4112, 0, 4112,
+    0, 0, 4112, 4112, 2064, 0, 0, 0, 4112, 0, 0, 0, 2064, 0, 4112, 4112,
+    4112, 0, 4112, 0, 4112, 0, 4112, 0, 0, 4098, 0, 4112, 20, 0, 0, 0,
+    0, 2049, 2050, 0, 4097, 0, 1025, 0, 2064, 0, 0, 0, 0, 0, 4112, 0,
+    0, 0, 0, 15, 0, 4106, 0, 0, 515, 4104, 2056, 0, 0, 0, 4104, 0,
+    0, 0, 2056, 0, 4104, 4106, 10, 0, 515, 0, 0, 0, 4104, 0, 0, 0,
+    514, 0, 0, 0, 514, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 514,
+    514, 0, 0, 0, 0, 514, 0, 514, 0, 4098, 2050, 0, 515, 0, 0, 0,
+    2052, 0, 4097, 0, 1025, 0, 0, 0, 2049, 1536, 0, 0, 4098, 0, 0, 515,
+    0, 0, 0, 0, 0, 2052, 0, 13, 4100, 0, 0, 0, 0, 2049, 2050, 0,
+    4097, 0, 1030, 0, 2056, 0, 0, 0, 0, 0, 1031, 0, 0, 0, 0, 7,
+    4100, 0, 4101, 0, 1030, 0, 2052, 0, 4097, 0, 1030, 0, 0, 0, 2049, 1536,
+    0, 0, 1031, 0, 1031, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0,
+    0, 0, 0, 0, 4098, 0, 4097, 512, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4116, 0, 0, 0, 0, 0, 4098,
+    0, 4113, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2052, 0, 4112, 4100, 0, 0, 0, 0, 4098, 2050, 0, 17, 0, 4112, 0,
+    2064, 0, 0, 0, 0, 0, 1029, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4098, 0, 0, 515, 0, 0, 0, 0, 4098,
+    2050, 0, 515, 0, 0, 0, 2056, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4098, 4100, 0, 515, 0, 0, 0, 2052, 0, 2050, 0, 4098, 0, 0, 515,
+    2049, 1536, 0, 0, 1029, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4098, 0, 0, 512, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 4098, 0, 4097, 512,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0,
+    0, 0, 4098, 0, 4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4160, 0, 4160, 4160, 0, 0, 0, 0, 4160, 4160, 0, 4160,
+    0, 112, 0, 4160, 0, 0, 0, 0, 0, 4160, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4160, 0, 2112, 4160, 0, 0,
+    0, 0, 4160, 4160, 0, 4160, 0, 4160, 0, 4160, 0, 0, 0, 0, 0, 104,
+    0, 0, 0, 0, 4128, 4160, 0, 4160, 0, 4128, 0, 4192, 0, 4160, 0, 4192,
+    0, 0, 4160, 4192, 4160, 0, 0, 4192, 0, 4128, 4192, 0, 0, 0, 0, 0,
+    0, 0, 0, 4100, 0, 0, 0, 0, 0, 4162, 0, 4161, 512, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4164, 0, 0, 0, 0, 0, 4162,
+    0, 4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4160, 0, 4160, 4160,
+    0, 0, 0, 0, 64, 4160, 0, 4160, 0, 88, 0, 88, 0, 0, 0, 0,
+    0, 2112, 0, 0, 0, 0, 4112, 4160, 0, 4160, 0, 4112, 0, 4176, 0, 4160,
+    0, 4112, 0, 0, 4176, 4112, 4176, 0, 0, 4176, 0, 4112, 4160, 0, 0, 0,
+    0, 0, 0, 0, 0, 4100, 0, 0, 0, 0, 0, 4098, 0, 4097, 512, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4104, 4160, 0, 4160,
+    0, 4104, 0, 4104, 0, 4160, 0, 4168, 0, 0, 4160, 4168, 4160, 0, 0, 4104,
+    0, 4104, 4160, 0, 0, 0, 0, 514, 0, 0, 0, 0, 514, 0, 514, 0,
+    0, 0, 514, 0, 0, 0, 514, 0, 0, 0, 514, 0, 514, 0, 0, 0,
+    0, 0, 0, 2112, 0, 2112, 4160, 0, 0, 0, 0, 4160, 4160, 0, 4160, 0,
+    4160, 0, 4160, 0, 0, 0, 0, 0, 2112, 0, 0, 0, 0, 0, 0, 0,
+    0, 4100, 0, 0, 0, 0, 0, 4098, 0, 4097, 512, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4160, 0, 69, 4160, 0, 0, 0,
+    0, 67, 4162, 0, 4161, 0, 1030, 0, 1027, 0, 0, 0, 0, 0, 4160, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4164, 0, 0,
+    0, 0, 0, 4162, 0, 4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4100, 0, 0, 0, 0, 0, 4162, 0, 4161, 512, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4160, 0, 69, 4164, 0,
+    0, 0, 0, 4160, 4160, 0, 4160, 0, 4160, 0, 4160, 0, 0, 0, 0, 0,
+    1029, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4104, 0, 4101, 60, 0, 0, 0, 0, 4112, 58, 0, 57, 0, 4112,
+    0, 4120, 0, 0, 0, 0, 0, 4104, 0, 0, 0, 0, 4097, 513, 0, 1,
+    0, 4112, 0, 0, 0, 51, 0, 4112, 0, 0, 4112, 4113, 513, 0, 0, 0,
+    0, 4097, 513, 0, 0, 0, 0, 0, 0, 0, 0, 4100, 0, 0, 0, 0,
+    0, 4114, 0, 4113, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4100, 46, 0, 2052, 0, 4100, 0, 4108, 0, 519, 0, 0, 0, 0,
+    519, 0, 519, 0, 0, 4104, 0, 2080, 4128, 0, 0, 0, 0, 39, 0, 4132,
+    0, 0, 36, 4133, 513, 0, 0, 0, 519, 0, 0, 0, 519, 0, 0, 4129,
+    513, 0, 4128, 0, 4128, 0, 0, 0, 0, 4100, 0, 4100, 2052, 0, 0, 0,
+    0, 0, 519, 0, 519, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2080, 0,
+    0, 0, 0, 0, 0, 0, 0, 4108, 0, 0, 0, 0, 0, 4106, 0, 4097,
+    512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4097, 513, 0, 0, 0, 0, 4097, 513, 0, 4097, 0, 1030, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4120, 8, 0, 29, 0, 4112, 0, 4104, 0, 4112, 0, 4112,
+    0, 0, 4112, 4112, 4112, 0, 0, 4104, 0, 4104, 2056, 0, 0, 0, 0, 23,
+    0, 4112, 0, 0, 4112, 4113, 513, 0, 0, 0, 4112, 0, 0, 0, 4112, 0,
+    4112, 4113, 513, 0, 17, 0, 4112, 0, 0, 0, 0, 4100, 0, 4100, 2052, 0,
+    0, 0, 0, 4112, 18, 0, 17, 0, 4112, 0, 4112, 0, 0, 0, 0, 0,
+    2064, 0, 0, 0, 0, 15, 0, 4108, 0, 0, 12, 4108, 12, 0, 0, 0,
+    519, 0, 0, 0, 519, 0, 0, 4104, 2056, 0, 2056, 0, 4104, 0, 4104, 0,
+    0, 0, 514, 0, 0, 0, 514, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 514, 514, 0, 0, 0, 0, 514, 0, 513, 0, 4100, 2052, 0, 2052, 0,
+    4100, 0, 4100, 0, 519, 0, 0, 0, 0, 519, 0, 519, 0, 0, 2050, 0,
+    2049, 1536, 0, 0, 0, 0, 0, 4104, 0, 4097, 12, 0, 0, 0, 0, 11,
+    4098, 0, 4097, 0, 1030, 0, 1027, 0, 0, 0, 0, 0, 4104, 0, 0, 0,
+    0, 4097, 513, 0, 4097, 0, 1030, 0, 0, 0, 4099, 0, 1030, 0, 0, 0,
+    1027, 0, 0, 0, 0, 0, 4097, 513, 0, 0, 0, 0, 0, 0, 0, 0,
+    4100, 0, 0, 0, 0, 0, 4098, 0, 4097, 512, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4108, 0, 0, 0, 0,
+    0, 4122, 0, 4113, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4097, 513, 0, 0, 0, 0, 4113, 513, 0, 17, 0,
+    4112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4108, 0, 4100, 4100, 0, 0, 0,
+    0, 0, 519, 0, 519, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1029, 0,
+    0, 0, 0, 4101, 513, 0, 4100, 0, 4100, 0, 0, 0, 519, 0, 0, 0,
+    0, 519, 0, 513, 0, 0, 0, 0, 1029, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4100, 0, 0, 0, 0, 0, 0, 0, 0, 512, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4097, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1028, 0, 0, 0, 0, 0, 1028,
+    0, 1028, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1028,
+    0, 0, 0, 0, 0, 1028, 0, 1028, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1028, 0, 1028, 0, 0, 0, 0, 0, 1028,
+    0, 0, 0, 0, 1028, 0, 1028, 0, 0, 0, 0, 0, 1028, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1028, 0, 0, 0, 0, 0, 1028, 0, 1028, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1028, 0, 1028, 0, 0, 0, 0,
+    0, 1028, 0, 0, 0, 0, 1028, 0, 1028, 0, 0, 0, 0, 0, 1028, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1028,
+    0, 1028, 0, 0, 0, 0, 0, 1028, 0, 0, 0, 0, 1028, 0, 1028, 0,
+    0, 0, 0, 0, 1028, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1028, 0, 0, 0, 0, 0, 1028, 0,
+    1028, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1028, 0,
+    0, 0, 0, 0, 1028, 0, 1028, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1028, 0, 0, 0, 0, 0, 1028, 0, 1028, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0,
+};
+
+#endif
@@ -0,0 +1,78 @@
+#include "ultimate.h"
+
+using namespace std;
+
+UltimateBoard::UltimateBoard()
+    : won_x_(0), won_o_(0), finished_(0), forced_(-1), winner_(0), moves_(0) {
+    for (int b = 0; b < 9; b++) {
+        x_[b] = 0;
+        o_[b] = 0;
+    }
+}
+
+int UltimateBoard::at(int move) const {
+    int b = move / 9, bit = 1 << (move % 9);
+    return (x_[b] & bit) ? 1 : (o_[b] & bit) ? -1 : 0;
+}
+
+int UltimateBoard::legal_moves(int* moves) const {
+    int count = 0;
+    for (uint16_t boards = open_boards(); boards; boards &= boards - 1) {
+        int b = __builtin_ctz(boards);
+        for (uint16_t cells = FULL_BOARD & ~(x_[b] | o_[b]); cells; cells &= cells - 1) {
+            moves[count++] = b * 9 + __builtin_ctz(cells);
+        }
+    }
+    return count;
+}
+
+bool UltimateBoard::play(int move, int player) {
+    int b = move / 9, cell = move % 9;
+    history_[moves_++] = forced_;
+    uint16_t& mine = (player == 1) ? x_[b] : o_[b];
+    mine |= 1 << cell;
+    if (has_line(mine)) {
+        uint16_t& won = (player == 1) ? won_x_ : won_o_;
+        won |= 1 << b;
+        finished_ |= 1 << b;
+        if (has_line(won)) {
+            winner_ = player;
+        }
+    } else if ((x_[b] | o_[b]) == FULL_BOARD) {
+        finished_ |= 1 << b;
+    }
+    forced_ = (finished_ >> cell & 1) ? -1 : cell;
+    return winner_ != 0;
+}
+
+void UltimateBoard::undo(int move) {
+    int b = move / 9;
+    uint16_t bit = ~(1 << (move % 9));
+    x_[b] &= bit;
+    o_[b] &= bit;
+    // The move was legal, so its board was unfinished before it
+    won_x_ &= ~(1 << b);
+    won_o_ &= ~(1 << b);
+    finished_ &= ~(1 << b);
+    winner_ = 0;
+    forced_ = history_[--moves_];
+}
+
+string UltimateBoard::render() const {
+    string out;
+    for (int row = 0; row < 9; row++) {
+        if (row == 3 || row == 6) {
+            out += "------+-------+------\n";
+        }
+        for (int col = 0; col < 9; col++) {
+            if (col == 3 || col == 6) {
+                out += "| ";
+            }
+            int move = (row / 3 * 3 + col / 3) * 9 + row % 3 * 3 + col % 3;
+            int stone = at(move);
+            out += stone == 1 ? 'X' : stone == -1 ? 'O' : '.';
+            out += (col == 8) ? '\n' : ' ';
+        }
+    }
+    return out;
+}
@@ -0,0 +1,69 @@
+#ifndef ULTIMATE_H
+#define ULTIMATE_H
+
+#include <cstdint>
+#include <string>
+#include "board.h"
+
+// Ultimate tic-tac-toe: a 3x3 grid of classic boards, each a pair of 9-bit
+// masks as in board.h. Moves are numbered board * 9 + cell, both 0-8 in the
+// classic order. Playing cell c sends the opponent to board c, unless that
+// board is finished, in which case any unfinished board is open. Winning a
+// board claims its cell of the meta-board, and a line of claimed boards
+// wins the game. Players are 1 (X, moves first) and -1 (O).
+class UltimateBoard {
+public:
+    UltimateBoard();
+
+    int size() const { return 81; }
+    int moves() const { return moves_; }
+    int winner() const { return winner_; }             // 1, -1 or 0
+    int forced() const { return forced_; }             // board to play in, -1 for any
+    bool full() const { return finished_ == FULL_BOARD; }
+    uint16_t claimed(int player) const { return player == 1 ? won_x_ : won_o_; }
+
+    // 1, -1 or 0 for the stone on a move's cell
+    int at(int move) const;
+
+    // Free cells of a board, or 0 when the side to move may not play there
+    uint16_t open_cells(int board) const {
+        if (winner_ || (finished_ >> board & 1) || (forced_ >= 0 && forced_ != board)) return 0;
+        return FULL_BOARD & ~(x_[board] | o_[board]);
+    }
+
+    // Boards the side to move may play in
+    uint16_t open_boards() const {
+        if (winner_) return 0;
+        return forced_ >= 0 ? 1 << forced_ : FULL_BOARD & ~finished_;
+    }
+
+    bool is_legal(int move) const {
+        return move >= 0 && move < 81 && (open_cells(move / 9) >> (move % 9) & 1);
+    }
+
+    // Function to list the legal moves; returns how many
+    int legal_moves(int* moves) const;
+
+    // Places a stone for player on a legal move; returns true when it wins
+    // the game
+    bool play(int move, int player);
+
+    // Takes back the last move (for search)
+    void undo(int move);
+
+    // Function to render the 9x9 grid, boards separated by lines
+    std::string render() const;
+
+private:
+    uint16_t x_[9];
+    uint16_t o_[9];
+    uint16_t won_x_;        // meta-board: boards claimed by X
+    uint16_t won_o_;        // ... and by O
+    uint16_t finished_;     // boards claimed or full
+    int forced_;
+    int winner_;
+    int moves_;
+    int8_t history_[81];    // forced board before each move, for undo
+};
+
+#endif